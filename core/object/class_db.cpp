@@ -1769,6 +1769,22 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+MethodBind *ClassDB::get_property_setter_method(const StringName &p_class, const StringName &p_property) {
+	ClassInfo *type = classes.getptr(p_class);
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			// Indexed properties need the index passed along, leave those to set_property().
+			return psg->index >= 0 ? nullptr : psg->_setptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
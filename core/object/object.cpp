@@ -42,21 +42,6 @@
 
 #ifdef DEBUG_ENABLED
 
-struct _ObjectDebugLock {
-	ObjectID obj_id;
-
-	_ObjectDebugLock(Object *p_obj) {
-		obj_id = p_obj->get_instance_id();
-		p_obj->_lock_index.ref();
-	}
-	~_ObjectDebugLock() {
-		Object *obj_ptr = ObjectDB::get_instance(obj_id);
-		if (likely(obj_ptr)) {
-			obj_ptr->_lock_index.unref();
-		}
-	}
-};
-
 #define OBJ_DEBUG_LOCK _ObjectDebugLock _debug_lock(this);
 
 #else
@@ -1207,19 +1192,40 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 	return emit_signalp(signal, args, argc);
 }
 
+void Object::SignalData::update_dispatch() {
+	Vector<Dispatch> new_dispatch;
+	new_dispatch.resize(slot_map.size());
+	Dispatch *w = new_dispatch.ptrw();
+
+	for (const KeyValue<Callable, Slot> &slot_kv : slot_map) {
+		const Callable &callable = slot_kv.value.conn.callable;
+		w->callable = callable;
+		w->flags = slot_kv.value.conn.flags;
+		w->method = nullptr;
+
+		if (callable.is_standard()) {
+			Object *target = callable.get_object();
+			// Extension methods may be unregistered on reload, so only native binds are kept around.
+			if (target && !target->_extension) {
+				w->target_id = target->get_instance_id();
+				w->method = ClassDB::get_method(target->get_class_name(), callable.get_method());
+			}
+		}
+		w++;
+	}
+
+	dispatch = new_dispatch;
+	dispatch_dirty = false;
+}
+
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
 	}
 
-	constexpr int MAX_SLOTS_ON_STACK = 5;
-	// Don't default initialize the Callable objects on the stack, just reserve the space - we'll memnew_placement() them later.
-	alignas(Callable) uint8_t slot_callable_stack[sizeof(Callable) * MAX_SLOTS_ON_STACK];
-	uint32_t slot_flags_stack[MAX_SLOTS_ON_STACK];
-
-	Callable *slot_callables = (Callable *)slot_callable_stack;
-	uint32_t *slot_flags = slot_flags_stack;
-	uint32_t slot_count = 0;
+	// Holding a reference to the dispatch buffer ensures that disconnecting the signal
+	// or even deleting the object will not affect the signal calling.
+	Vector<SignalData::Dispatch> dispatch;
 
 	{
 		OBJ_SIGNAL_LOCK
@@ -1239,32 +1245,24 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 		Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
-		if (s->slot_map.size() > MAX_SLOTS_ON_STACK) {
-			slot_callables = (Callable *)memalloc(sizeof(Callable) * s->slot_map.size());
-			slot_flags = (uint32_t *)memalloc(sizeof(uint32_t) * s->slot_map.size());
-		}
-
-		// Ensure that disconnecting the signal or even deleting the object
-		// will not affect the signal calling.
-		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-			slot_flags[slot_count] = slot_kv.value.conn.flags;
-			++slot_count;
+		if (s->dispatch_dirty) {
+			s->update_dispatch();
 		}
+		dispatch = s->dispatch;
 
-		DEV_ASSERT(slot_count == s->slot_map.size());
+		DEV_ASSERT(dispatch.size() == (int)s->slot_map.size());
 
 		// Disconnect all one-shot connections before emitting to prevent recursion.
-		for (uint32_t i = 0; i < slot_count; ++i) {
-			bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+		for (const SignalData::Dispatch &E : dispatch) {
+			bool disconnect = E.flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-			if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+			if (disconnect && (E.flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
 				// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
 				disconnect = false;
 			}
 #endif
 			if (disconnect) {
-				_disconnect(p_name, slot_callables[i]);
+				_disconnect(p_name, E.callable);
 			}
 		}
 	}
@@ -1273,53 +1271,79 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	Error err = OK;
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
-
-		if (!callable.is_valid()) {
-			// Target might have been deleted during signal callback, this is expected and OK.
-			continue;
-		}
+	for (const SignalData::Dispatch &E : dispatch) {
+		const Callable &callable = E.callable;
+		const uint32_t &flags = E.flags;
 
 		const Variant **args = p_args;
 		int argc = p_argcount;
 
 		if (flags & CONNECT_DEFERRED) {
+			if (!callable.is_valid()) {
+				// Target might have been deleted during signal callback, this is expected and OK.
+				continue;
+			}
 			MessageQueue::get_singleton()->push_callablep(callable, args, argc, true);
+			continue;
+		}
+
+		Callable::CallError ce;
+		Variant ret;
+
+		if (E.method) {
+			Object *target = ObjectDB::get_instance(E.target_id);
+			if (!target) {
+				// Target might have been deleted during signal callback, this is expected and OK.
+				continue;
+			}
+			if (!target->script_instance) {
+				// Native method on a target without script, skip the method lookup in Object::callp().
+#ifdef DEBUG_ENABLED
+				_ObjectDebugLock target_lock(target);
+#endif
+				_emitting = true;
+				ret = E.method->call(target, args, argc, ce);
+				_emitting = false;
+			} else if (callable.is_valid()) {
+				_emitting = true;
+				callable.callp(args, argc, ret, ce);
+				_emitting = false;
+			} else {
+				continue;
+			}
+		} else if (callable.is_custom()) {
+			CallableCustom *custom = callable.get_custom();
+			if (!custom->is_valid()) {
+				continue;
+			}
+			_emitting = true;
+			custom->call(args, argc, ret, ce);
+			_emitting = false;
 		} else {
-			Callable::CallError ce;
+			if (!callable.is_valid()) {
+				continue;
+			}
 			_emitting = true;
-			Variant ret;
 			callable.callp(args, argc, ret, ce);
 			_emitting = false;
+		}
 
-			if (ce.error != Callable::CallError::CALL_OK) {
+		if (ce.error != Callable::CallError::CALL_OK) {
 #ifdef DEBUG_ENABLED
-				if (flags & CONNECT_PERSIST && Engine::get_singleton()->is_editor_hint() && (script.is_null() || !Ref<Script>(script)->is_tool())) {
-					continue;
-				}
+			if (flags & CONNECT_PERSIST && Engine::get_singleton()->is_editor_hint() && (script.is_null() || !Ref<Script>(script)->is_tool())) {
+				continue;
+			}
 #endif
-				Object *target = callable.get_object();
-				if (ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && target && !ClassDB::class_exists(target->get_class_name())) {
-					//most likely object is not initialized yet, do not throw error.
-				} else {
-					ERR_PRINT(vformat("Error calling from signal '%s' to callable: %s.", String(p_name), Variant::get_callable_error_text(callable, args, argc, ce)));
-					err = ERR_METHOD_NOT_FOUND;
-				}
+			Object *target = callable.get_object();
+			if (ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && target && !ClassDB::class_exists(target->get_class_name())) {
+				//most likely object is not initialized yet, do not throw error.
+			} else {
+				ERR_PRINT(vformat("Error calling from signal '%s' to callable: %s.", String(p_name), Variant::get_callable_error_text(callable, args, argc, ce)));
+				err = ERR_METHOD_NOT_FOUND;
 			}
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
-	}
-
-	if (slot_callables != (Callable *)slot_callable_stack) {
-		memfree(slot_callables);
-		memfree(slot_flags);
-	}
-
 	return err;
 }
 
@@ -1545,6 +1569,8 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->dispatch = Vector<SignalData::Dispatch>();
+	s->dispatch_dirty = true;
 
 	return OK;
 }
@@ -1625,6 +1651,9 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	// Release the copies held by the dispatch list now, they may keep bound arguments or captured references alive.
+	s->dispatch = Vector<SignalData::Dispatch>();
+	s->dispatch_dirty = true;
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -617,9 +617,22 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// Flattened copy of the slots used by emit_signalp(), rebuilt lazily after connect/disconnect.
+		// Emission holds its own reference to the buffer, so changes made by callbacks never touch it.
+		struct Dispatch {
+			Callable callable;
+			uint32_t flags = 0;
+			ObjectID target_id;
+			MethodBind *method = nullptr; // Only set for native methods, called directly when the target has no script.
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		Vector<Dispatch> dispatch;
+		bool dispatch_dirty = true;
 		bool removable = false;
+
+		void update_dispatch();
 	};
 	friend struct _ObjectSignalLock;
 	mutable Mutex *signal_mutex = nullptr;
@@ -1081,3 +1094,23 @@ public:
 	static void debug_objects(DebugFunc p_func);
 	static int get_object_count();
 };
+
+#ifdef DEBUG_ENABLED
+
+// Reports objects freed while they are being called into, see Object::callp().
+struct _ObjectDebugLock {
+	ObjectID obj_id;
+
+	_ObjectDebugLock(Object *p_obj) {
+		obj_id = p_obj->get_instance_id();
+		p_obj->_lock_index.ref();
+	}
+	~_ObjectDebugLock() {
+		Object *obj_ptr = ObjectDB::get_instance(obj_id);
+		if (likely(obj_ptr)) {
+			obj_ptr->_lock_index.unref();
+		}
+	}
+};
+
+#endif // DEBUG_ENABLED
@@ -667,6 +667,100 @@ static _FORCE_INLINE_ void vc_ptrcall(void (*method)(T *, P...), void *p_base, c
 		p_instance->set(p_index, p_value);                                                                      \
 	}
 
+#define VARCALL_PACKED_FLOAT_ARRAY_MATH(m_packed_type, m_type)                                                                \
+	static m_packed_type func_##m_packed_type##_add(m_packed_type *p_instance, const m_packed_type &p_array) {                \
+		const int64_t size = p_instance->size();                                                                              \
+		ERR_FAIL_COND_V_MSG(p_array.size() != size, m_packed_type(), "Both arrays must have the same size.");                 \
+		m_packed_type ret;                                                                                                    \
+		ret.resize(size);                                                                                                     \
+		const m_type *a = p_instance->ptr();                                                                                  \
+		const m_type *b = p_array.ptr();                                                                                      \
+		m_type *w = ret.ptrw();                                                                                               \
+		for (int64_t i = 0; i < size; i++) {                                                                                  \
+			w[i] = a[i] + b[i];                                                                                               \
+		}                                                                                                                     \
+		return ret;                                                                                                           \
+	}                                                                                                                         \
+	static m_packed_type func_##m_packed_type##_multiply(m_packed_type *p_instance, const m_packed_type &p_array) {           \
+		const int64_t size = p_instance->size();                                                                              \
+		ERR_FAIL_COND_V_MSG(p_array.size() != size, m_packed_type(), "Both arrays must have the same size.");                 \
+		m_packed_type ret;                                                                                                    \
+		ret.resize(size);                                                                                                     \
+		const m_type *a = p_instance->ptr();                                                                                  \
+		const m_type *b = p_array.ptr();                                                                                      \
+		m_type *w = ret.ptrw();                                                                                               \
+		for (int64_t i = 0; i < size; i++) {                                                                                  \
+			w[i] = a[i] * b[i];                                                                                               \
+		}                                                                                                                     \
+		return ret;                                                                                                           \
+	}                                                                                                                         \
+	static m_packed_type func_##m_packed_type##_lerp(m_packed_type *p_instance, const m_packed_type &p_to, double p_weight) { \
+		const int64_t size = p_instance->size();                                                                              \
+		ERR_FAIL_COND_V_MSG(p_to.size() != size, m_packed_type(), "Both arrays must have the same size.");                    \
+		m_packed_type ret;                                                                                                    \
+		ret.resize(size);                                                                                                     \
+		const m_type *a = p_instance->ptr();                                                                                  \
+		const m_type *b = p_to.ptr();                                                                                         \
+		const m_type weight = (m_type)p_weight;                                                                               \
+		m_type *w = ret.ptrw();                                                                                               \
+		for (int64_t i = 0; i < size; i++) {                                                                                  \
+			w[i] = a[i] + (b[i] - a[i]) * weight;                                                                             \
+		}                                                                                                                     \
+		return ret;                                                                                                           \
+	}                                                                                                                         \
+	static m_packed_type func_##m_packed_type##_clamp(m_packed_type *p_instance, double p_min, double p_max) {                \
+		const int64_t size = p_instance->size();                                                                              \
+		m_packed_type ret;                                                                                                    \
+		ret.resize(size);                                                                                                     \
+		const m_type *r = p_instance->ptr();                                                                                  \
+		const m_type min = (m_type)p_min;                                                                                     \
+		const m_type max = (m_type)p_max;                                                                                     \
+		m_type *w = ret.ptrw();                                                                                               \
+		for (int64_t i = 0; i < size; i++) {                                                                                  \
+			w[i] = r[i] < min ? min : (r[i] > max ? max : r[i]);                                                              \
+		}                                                                                                                     \
+		return ret;                                                                                                           \
+	}                                                                                                                         \
+	static double func_##m_packed_type##_sum(m_packed_type *p_instance) {                                                     \
+		const int64_t size = p_instance->size();                                                                              \
+		const m_type *r = p_instance->ptr();                                                                                  \
+		double sum = 0.0;                                                                                                     \
+		for (int64_t i = 0; i < size; i++) {                                                                                  \
+			sum += r[i];                                                                                                      \
+		}                                                                                                                     \
+		return sum;                                                                                                           \
+	}                                                                                                                         \
+	static int64_t func_##m_packed_type##_argmin(m_packed_type *p_instance) {                                                 \
+		const int64_t size = p_instance->size();                                                                              \
+		const m_type *r = p_instance->ptr();                                                                                  \
+		int64_t index = size > 0 ? 0 : -1;                                                                                    \
+		for (int64_t i = 1; i < size; i++) {                                                                                  \
+			if (r[i] < r[index]) {                                                                                            \
+				index = i;                                                                                                    \
+			}                                                                                                                 \
+		}                                                                                                                     \
+		return index;                                                                                                         \
+	}                                                                                                                         \
+	static int64_t func_##m_packed_type##_argmax(m_packed_type *p_instance) {                                                 \
+		const int64_t size = p_instance->size();                                                                              \
+		const m_type *r = p_instance->ptr();                                                                                  \
+		int64_t index = size > 0 ? 0 : -1;                                                                                    \
+		for (int64_t i = 1; i < size; i++) {                                                                                  \
+			if (r[i] > r[index]) {                                                                                            \
+				index = i;                                                                                                    \
+			}                                                                                                                 \
+		}                                                                                                                     \
+		return index;                                                                                                         \
+	}                                                                                                                         \
+	static double func_##m_packed_type##_min(m_packed_type *p_instance) {                                                     \
+		const int64_t index = func_##m_packed_type##_argmin(p_instance);                                                      \
+		return index < 0 ? 0.0 : (double)p_instance->ptr()[index];                                                            \
+	}                                                                                                                         \
+	static double func_##m_packed_type##_max(m_packed_type *p_instance) {                                                     \
+		const int64_t index = func_##m_packed_type##_argmax(p_instance);                                                      \
+		return index < 0 ? 0.0 : (double)p_instance->ptr()[index];                                                            \
+	}
+
 struct _VariantCall {
 	VARCALL_ARRAY_GETTER_SETTER(PackedByteArray, uint8_t)
 	VARCALL_ARRAY_GETTER_SETTER(PackedColorArray, Color)
@@ -680,6 +774,35 @@ struct _VariantCall {
 	VARCALL_ARRAY_GETTER_SETTER(PackedVector4Array, Vector4)
 	VARCALL_ARRAY_GETTER_SETTER(Array, Variant)
 
+	VARCALL_PACKED_FLOAT_ARRAY_MATH(PackedFloat32Array, float)
+	VARCALL_PACKED_FLOAT_ARRAY_MATH(PackedFloat64Array, double)
+
+	static PackedFloat32Array func_PackedVector3Array_dot(PackedVector3Array *p_instance, const PackedVector3Array &p_with) {
+		const int64_t size = p_instance->size();
+		ERR_FAIL_COND_V_MSG(p_with.size() != size, PackedFloat32Array(), "Both arrays must have the same size.");
+		PackedFloat32Array ret;
+		ret.resize(size);
+		const Vector3 *a = p_instance->ptr();
+		const Vector3 *b = p_with.ptr();
+		float *w = ret.ptrw();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = a[i].x * b[i].x + a[i].y * b[i].y + a[i].z * b[i].z;
+		}
+		return ret;
+	}
+
+	static PackedFloat32Array func_PackedVector3Array_lengths(PackedVector3Array *p_instance) {
+		const int64_t size = p_instance->size();
+		PackedFloat32Array ret;
+		ret.resize(size);
+		const Vector3 *r = p_instance->ptr();
+		float *w = ret.ptrw();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = Math::sqrt(r[i].x * r[i].x + r[i].y * r[i].y + r[i].z * r[i].z);
+		}
+		return ret;
+	}
+
 	static String func_PackedByteArray_get_string_from_ascii(PackedByteArray *p_instance) {
 		String s;
 		if (p_instance->size() > 0) {
@@ -2711,6 +2834,15 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
 	bind_method(PackedFloat32Array, erase, sarray("value"), varray());
+	bind_function(PackedFloat32Array, add, _VariantCall::func_PackedFloat32Array_add, sarray("array"), varray());
+	bind_function(PackedFloat32Array, multiply, _VariantCall::func_PackedFloat32Array_multiply, sarray("array"), varray());
+	bind_function(PackedFloat32Array, lerp, _VariantCall::func_PackedFloat32Array_lerp, sarray("to", "weight"), varray());
+	bind_function(PackedFloat32Array, clamp, _VariantCall::func_PackedFloat32Array_clamp, sarray("min", "max"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_PackedFloat32Array_sum, sarray(), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_PackedFloat32Array_min, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_PackedFloat32Array_max, sarray(), varray());
+	bind_function(PackedFloat32Array, argmin, _VariantCall::func_PackedFloat32Array_argmin, sarray(), varray());
+	bind_function(PackedFloat32Array, argmax, _VariantCall::func_PackedFloat32Array_argmax, sarray(), varray());
 
 	/* Float64 Array */
 
@@ -2735,6 +2867,15 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat64Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
 	bind_method(PackedFloat64Array, erase, sarray("value"), varray());
+	bind_function(PackedFloat64Array, add, _VariantCall::func_PackedFloat64Array_add, sarray("array"), varray());
+	bind_function(PackedFloat64Array, multiply, _VariantCall::func_PackedFloat64Array_multiply, sarray("array"), varray());
+	bind_function(PackedFloat64Array, lerp, _VariantCall::func_PackedFloat64Array_lerp, sarray("to", "weight"), varray());
+	bind_function(PackedFloat64Array, clamp, _VariantCall::func_PackedFloat64Array_clamp, sarray("min", "max"), varray());
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_PackedFloat64Array_sum, sarray(), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_PackedFloat64Array_min, sarray(), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_PackedFloat64Array_max, sarray(), varray());
+	bind_function(PackedFloat64Array, argmin, _VariantCall::func_PackedFloat64Array_argmin, sarray(), varray());
+	bind_function(PackedFloat64Array, argmax, _VariantCall::func_PackedFloat64Array_argmax, sarray(), varray());
 
 	/* String Array */
 
@@ -2807,6 +2948,8 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
 	bind_method(PackedVector3Array, erase, sarray("value"), varray());
+	bind_function(PackedVector3Array, dot, _VariantCall::func_PackedVector3Array_dot, sarray("with"), varray());
+	bind_function(PackedVector3Array, lengths, _VariantCall::func_PackedVector3Array_lengths, sarray(), varray());
 
 	/* Color Array */
 
@@ -259,6 +259,10 @@ static bool force_res = false;
 // Debug
 
 static bool use_debug_profiler = false;
+#if defined(DEBUG_ENABLED) && defined(MODULE_GDSCRIPT_ENABLED)
+static String gdscript_sampling_profile_path;
+static int gdscript_sampling_rate = 1000;
+#endif
 #ifdef DEBUG_ENABLED
 static bool debug_collisions = false;
 static bool debug_paths = false;
@@ -628,6 +632,10 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("-b, --breakpoints", "Breakpoint list as source::line comma-separated pairs, no spaces (use %%20 instead).\n");
 	print_help_option("--ignore-error-breaks", "If debugger is connected, prevents sending error breakpoints.\n");
 	print_help_option("--profiling", "Enable profiling in the script debugger.\n");
+#if defined(DEBUG_ENABLED) && defined(MODULE_GDSCRIPT_ENABLED)
+	print_help_option("--gdscript-sampling-profile <file>", "Sample GDScript call stacks while running and write them to <file> as folded stacks on exit (flamegraph-compatible).\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
+	print_help_option("--gdscript-sampling-rate <hz>", "Number of GDScript call stack samples taken per second when using --gdscript-sampling-profile (default: 1000).\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
+#endif
 	print_help_option("--gpu-profile", "Show a GPU profile of the tasks that took the most time during frame rendering.\n");
 	print_help_option("--gpu-validation", "Enable graphics API validation layers for debugging.\n");
 #ifdef DEBUG_ENABLED
@@ -1420,6 +1428,28 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		} else if (arg == "--profiling") { // enable profiling
 
 			use_debug_profiler = true;
+#if defined(DEBUG_ENABLED) && defined(MODULE_GDSCRIPT_ENABLED)
+		} else if (arg == "--gdscript-sampling-profile") {
+			if (N) {
+				gdscript_sampling_profile_path = N->get();
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing file path argument for --gdscript-sampling-profile, aborting.\n");
+				goto error;
+			}
+		} else if (arg == "--gdscript-sampling-rate") {
+			if (N) {
+				gdscript_sampling_rate = N->get().to_int();
+				N = N->next();
+				if (gdscript_sampling_rate <= 0) {
+					OS::get_singleton()->print("Invalid --gdscript-sampling-rate argument, must be greater than zero, aborting.\n");
+					goto error;
+				}
+			} else {
+				OS::get_singleton()->print("Missing rate argument for --gdscript-sampling-rate, aborting.\n");
+				goto error;
+			}
+#endif
 
 		} else if (arg == "-l" || arg == "--language") { // language
 
@@ -3735,6 +3765,12 @@ Error Main::setup2(bool p_show_boot_logo) {
 		EngineDebugger::get_singleton()->profiler_enable("scripts", true);
 	}
 
+#if defined(DEBUG_ENABLED) && defined(MODULE_GDSCRIPT_ENABLED)
+	if (!gdscript_sampling_profile_path.is_empty() && GDScriptLanguage::get_singleton()) {
+		GDScriptLanguage::get_singleton()->sampling_start(gdscript_sampling_rate);
+	}
+#endif
+
 	if (!project_manager) {
 		// If not running the project manager, and now that the engine is
 		// able to load resources, load the global shader variables.
@@ -4992,6 +5028,13 @@ void Main::cleanup(bool p_force) {
 
 	WorkerThreadPool::get_singleton()->exit_languages_threads();
 
+#if defined(DEBUG_ENABLED) && defined(MODULE_GDSCRIPT_ENABLED)
+	if (GDScriptLanguage::get_singleton() && GDScriptLanguage::get_singleton()->is_sampling()) {
+		GDScriptLanguage::get_singleton()->sampling_stop();
+		GDScriptLanguage::get_singleton()->sampling_save_folded_stacks(gdscript_sampling_profile_path);
+	}
+#endif
+
 	ScriptServer::finish_languages();
 
 	// Sync pending commands that may have been queued from a different thread during ScriptServer finalization
@@ -32,7 +32,9 @@
 
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
+#include "scene/gui/container.h"
 #include "scene/main/node.h"
+#include "scene/main/node_pool.h"
 #include "scene/main/scene_tree.h"
 #include "servers/audio_server.h"
 #ifndef NAVIGATION_2D_DISABLED
@@ -129,6 +131,10 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(OBJECT_NODE_POOL_HITS);
+	BIND_ENUM_CONSTANT(OBJECT_NODE_POOL_MISSES);
+	BIND_ENUM_CONSTANT(GUI_LAYOUT_SORT_COUNT);
+	BIND_ENUM_CONSTANT(TIME_GUI_LAYOUT);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -209,6 +215,10 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("object/node_pool_hits"),
+		PNAME("object/node_pool_misses"),
+		PNAME("gui/layout_sorts"),
+		PNAME("time/gui_layout"),
 	};
 	static_assert(std::size(names) == MONITOR_MAX);
 
@@ -433,6 +443,15 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
 
+		case OBJECT_NODE_POOL_HITS:
+			return NodePool::get_total_hit_count();
+		case OBJECT_NODE_POOL_MISSES:
+			return NodePool::get_total_miss_count();
+		case GUI_LAYOUT_SORT_COUNT:
+			return Container::get_last_frame_sort_count();
+		case TIME_GUI_LAYOUT:
+			return Container::get_last_frame_sort_time();
+
 		default: {
 		}
 	}
@@ -503,6 +522,10 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
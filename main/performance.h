@@ -125,6 +125,10 @@ public:
 		NAVIGATION_3D_EDGE_CONNECTION_COUNT,
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
+		OBJECT_NODE_POOL_HITS,
+		OBJECT_NODE_POOL_MISSES,
+		GUI_LAYOUT_SORT_COUNT,
+		TIME_GUI_LAYOUT,
 		MONITOR_MAX
 	};
 
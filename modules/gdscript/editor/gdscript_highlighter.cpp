@@ -689,6 +689,15 @@ Dictionary GDScriptSyntaxHighlighter::_get_line_syntax_highlighting_impl(int p_l
 	return color_map;
 }
 
+bool GDScriptSyntaxHighlighter::_get_line_end_state(int p_line, int &r_state) const {
+	const int *region = color_region_cache.getptr(p_line);
+	if (region == nullptr) {
+		return false;
+	}
+	r_state = *region;
+	return true;
+}
+
 String GDScriptSyntaxHighlighter::_get_name() const {
 	return "GDScript";
 }
@@ -109,6 +109,7 @@ private:
 public:
 	virtual void _update_cache() override;
 	virtual Dictionary _get_line_syntax_highlighting_impl(int p_line) override;
+	virtual bool _get_line_end_state(int p_line, int &r_state) const override;
 
 	virtual String _get_name() const override;
 	virtual PackedStringArray _get_supported_languages() const override;
@@ -2329,6 +2329,10 @@ void GDScriptLanguage::finish() {
 	}
 	finishing = true;
 
+#ifdef DEBUG_ENABLED
+	sampling_stop();
+#endif
+
 	// Clear the cache before parsing the script_list
 	GDScriptCache::clear();
 
@@ -2484,6 +2488,95 @@ int GDScriptLanguage::profiling_get_frame_data(ProfilingInfo *p_info_arr, int p_
 	return current;
 }
 
+#ifdef DEBUG_ENABLED
+void GDScriptLanguage::_sampling_thread_func(void *p_userdata) {
+	GDScriptLanguage *language = (GDScriptLanguage *)p_userdata;
+	while (!language->sampling_exit.is_set()) {
+		OS::get_singleton()->delay_usec(language->sampling_interval_usec);
+		language->sampling_tick.increment();
+	}
+}
+
+void GDScriptLanguage::_sampling_take_sample() {
+	const uint64_t tick = sampling_tick.get();
+	const uint64_t weight = tick - _sampling_last_tick;
+	_sampling_last_tick = tick;
+	if (_call_stack_size == 0) {
+		return;
+	}
+
+	// Frames are stored leaf first, folded stacks are written root first.
+	LocalVector<const CallLevel *> levels;
+	levels.reserve(_call_stack_size);
+	for (const CallLevel *cl = _call_stack; cl; cl = cl->prev) {
+		levels.push_back(cl);
+	}
+
+	String folded = Thread::is_main_thread() ? "main" : "thread_" + itos(Thread::get_caller_id());
+	for (int64_t i = levels.size() - 1; i >= 0; i--) {
+		const CallLevel *cl = levels[i];
+		folded += ";";
+		if (cl->function) {
+			folded += String(cl->function->get_name()) + " (" + cl->function->get_script()->get_script_path() + ":" + itos(*cl->line) + ")";
+		} else {
+			folded += "<unknown>";
+		}
+	}
+
+	MutexLock lock(sampling_mutex);
+	HashMap<String, uint64_t>::Iterator E = sampled_stacks.find(folded);
+	if (E) {
+		E->value += weight;
+	} else {
+		sampled_stacks.insert(folded, weight);
+	}
+}
+
+void GDScriptLanguage::sampling_start(int p_frequency) {
+	ERR_FAIL_COND_MSG(p_frequency <= 0, "GDScript sampling frequency must be greater than zero.");
+	ERR_FAIL_COND_MSG(!track_call_stack, "GDScript sampling requires call stack tracking.");
+	if (sampling.is_set()) {
+		sampling_stop();
+	}
+
+	{
+		MutexLock lock(sampling_mutex);
+		sampled_stacks.clear();
+	}
+	sampling_interval_usec = MAX(1000000 / p_frequency, 1);
+	sampling_exit.clear();
+	sampling.set();
+	sampling_thread.start(_sampling_thread_func, this);
+}
+
+void GDScriptLanguage::sampling_stop() {
+	if (!sampling.is_set()) {
+		return;
+	}
+	sampling.clear();
+	sampling_exit.set();
+	sampling_thread.wait_to_finish();
+}
+
+String GDScriptLanguage::sampling_get_folded_stacks() {
+	MutexLock lock(sampling_mutex);
+
+	String folded;
+	for (const KeyValue<String, uint64_t> &E : sampled_stacks) {
+		folded += E.key + " " + itos(E.value) + "\n";
+	}
+	return folded;
+}
+
+Error GDScriptLanguage::sampling_save_folded_stacks(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Cannot open file '%s' to save GDScript sampling profile.", p_path));
+	f->store_string(sampling_get_folded_stacks());
+	return OK;
+}
+#endif // DEBUG_ENABLED
+
 void GDScriptLanguage::profiling_collate_native_call_data(bool p_accumulated) {
 #ifdef DEBUG_ENABLED
 	// The same native call can be called from multiple functions, so join them together here.
@@ -2922,6 +3015,9 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 
 thread_local GDScriptLanguage::CallLevel *GDScriptLanguage::_call_stack = nullptr;
 thread_local uint32_t GDScriptLanguage::_call_stack_size = 0;
+#ifdef DEBUG_ENABLED
+thread_local uint64_t GDScriptLanguage::_sampling_last_tick = 0;
+#endif
 
 GDScriptLanguage::CallLevel *GDScriptLanguage::_get_stack_level(uint32_t p_level) {
 	ERR_FAIL_UNSIGNED_INDEX_V(p_level, _call_stack_size, nullptr);
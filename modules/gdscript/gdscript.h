@@ -38,6 +38,7 @@
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
 #include "core/templates/rb_set.h"
 
 class GDScriptNativeClass : public RefCounted {
@@ -470,6 +471,21 @@ class GDScriptLanguage : public ScriptLanguage {
 	bool profiling;
 	bool profile_native_calls;
 	uint64_t script_frame_time;
+
+	// Sampling profiler. A timer thread bumps `sampling_tick` at a fixed rate, and each
+	// script thread records its own call stack the next time it reaches a line boundary,
+	// weighted by the number of ticks elapsed since its previous sample.
+	SafeFlag sampling;
+	SafeNumeric<uint64_t> sampling_tick;
+	static thread_local uint64_t _sampling_last_tick;
+	uint64_t sampling_interval_usec = 0;
+	SafeFlag sampling_exit;
+	Thread sampling_thread;
+	Mutex sampling_mutex;
+	HashMap<String, uint64_t> sampled_stacks;
+
+	static void _sampling_thread_func(void *p_userdata);
+	void _sampling_take_sample();
 #endif
 
 	HashMap<String, ObjectID> orphan_subclasses;
@@ -507,6 +523,13 @@ public:
 			return;
 		}
 
+#ifdef DEBUG_ENABLED
+		if (_call_stack_size == 0) {
+			// Time spent outside of scripts must not be attributed to the first sampled line.
+			_sampling_last_tick = sampling_tick.get();
+		}
+#endif
+
 		call_level->prev = _call_stack;
 		_call_stack = call_level;
 		call_level->stack = p_stack;
@@ -578,6 +601,20 @@ public:
 
 	} strings;
 
+#ifdef DEBUG_ENABLED
+	_FORCE_INLINE_ void sampling_poll() {
+		if (unlikely(sampling.is_set() && sampling_tick.get() != _sampling_last_tick)) {
+			_sampling_take_sample();
+		}
+	}
+
+	void sampling_start(int p_frequency);
+	void sampling_stop();
+	_FORCE_INLINE_ bool is_sampling() const { return sampling.is_set(); }
+	String sampling_get_folded_stacks();
+	Error sampling_save_folded_stacks(const String &p_path);
+#endif
+
 	_FORCE_INLINE_ bool should_track_call_stack() const { return track_call_stack; }
 	_FORCE_INLINE_ bool should_track_locals() const { return track_locals; }
 	_FORCE_INLINE_ int get_global_array_size() const { return global_array.size(); }
@@ -1656,6 +1656,31 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 				case Variant::ARRAY:
 					begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_ARRAY;
 					iterate_opcode = GDScriptFunction::OPCODE_ITERATE_ARRAY;
+					if (container.type.has_container_element_type(0)) {
+						const GDScriptDataType &element_type = container.type.container_element_types[0];
+						if (element_type.has_type && element_type.kind == GDScriptDataType::BUILTIN) {
+							switch (element_type.builtin_type) {
+								case Variant::INT:
+									begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_TYPED_ARRAY_INT;
+									iterate_opcode = GDScriptFunction::OPCODE_ITERATE_TYPED_ARRAY_INT;
+									break;
+								case Variant::FLOAT:
+									begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_TYPED_ARRAY_FLOAT;
+									iterate_opcode = GDScriptFunction::OPCODE_ITERATE_TYPED_ARRAY_FLOAT;
+									break;
+								case Variant::VECTOR2:
+									begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_TYPED_ARRAY_VECTOR2;
+									iterate_opcode = GDScriptFunction::OPCODE_ITERATE_TYPED_ARRAY_VECTOR2;
+									break;
+								case Variant::VECTOR3:
+									begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_TYPED_ARRAY_VECTOR3;
+									iterate_opcode = GDScriptFunction::OPCODE_ITERATE_TYPED_ARRAY_VECTOR3;
+									break;
+								default:
+									break;
+							}
+						}
+					}
 					break;
 				case Variant::PACKED_BYTE_ARRAY:
 					begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_BYTE_ARRAY;
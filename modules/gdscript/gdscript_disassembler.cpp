@@ -1156,6 +1156,10 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 	m_macro(STRING);                       \
 	m_macro(DICTIONARY);                   \
 	m_macro(ARRAY);                        \
+	m_macro(TYPED_ARRAY_INT);              \
+	m_macro(TYPED_ARRAY_FLOAT);            \
+	m_macro(TYPED_ARRAY_VECTOR2);          \
+	m_macro(TYPED_ARRAY_VECTOR3);          \
 	m_macro(PACKED_BYTE_ARRAY);            \
 	m_macro(PACKED_INT32_ARRAY);           \
 	m_macro(PACKED_INT64_ARRAY);           \
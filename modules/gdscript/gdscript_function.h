@@ -347,6 +347,10 @@ public:
 		OPCODE_ITERATE_BEGIN_STRING,
 		OPCODE_ITERATE_BEGIN_DICTIONARY,
 		OPCODE_ITERATE_BEGIN_ARRAY,
+		OPCODE_ITERATE_BEGIN_TYPED_ARRAY_INT,
+		OPCODE_ITERATE_BEGIN_TYPED_ARRAY_FLOAT,
+		OPCODE_ITERATE_BEGIN_TYPED_ARRAY_VECTOR2,
+		OPCODE_ITERATE_BEGIN_TYPED_ARRAY_VECTOR3,
 		OPCODE_ITERATE_BEGIN_PACKED_BYTE_ARRAY,
 		OPCODE_ITERATE_BEGIN_PACKED_INT32_ARRAY,
 		OPCODE_ITERATE_BEGIN_PACKED_INT64_ARRAY,
@@ -369,6 +373,10 @@ public:
 		OPCODE_ITERATE_STRING,
 		OPCODE_ITERATE_DICTIONARY,
 		OPCODE_ITERATE_ARRAY,
+		OPCODE_ITERATE_TYPED_ARRAY_INT,
+		OPCODE_ITERATE_TYPED_ARRAY_FLOAT,
+		OPCODE_ITERATE_TYPED_ARRAY_VECTOR2,
+		OPCODE_ITERATE_TYPED_ARRAY_VECTOR3,
 		OPCODE_ITERATE_PACKED_BYTE_ARRAY,
 		OPCODE_ITERATE_PACKED_INT32_ARRAY,
 		OPCODE_ITERATE_PACKED_INT64_ARRAY,
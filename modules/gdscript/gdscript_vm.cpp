@@ -332,6 +332,10 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_ITERATE_BEGIN_STRING,                   \
 		&&OPCODE_ITERATE_BEGIN_DICTIONARY,               \
 		&&OPCODE_ITERATE_BEGIN_ARRAY,                    \
+		&&OPCODE_ITERATE_BEGIN_TYPED_ARRAY_INT,          \
+		&&OPCODE_ITERATE_BEGIN_TYPED_ARRAY_FLOAT,        \
+		&&OPCODE_ITERATE_BEGIN_TYPED_ARRAY_VECTOR2,      \
+		&&OPCODE_ITERATE_BEGIN_TYPED_ARRAY_VECTOR3,      \
 		&&OPCODE_ITERATE_BEGIN_PACKED_BYTE_ARRAY,        \
 		&&OPCODE_ITERATE_BEGIN_PACKED_INT32_ARRAY,       \
 		&&OPCODE_ITERATE_BEGIN_PACKED_INT64_ARRAY,       \
@@ -354,6 +358,10 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_ITERATE_STRING,                         \
 		&&OPCODE_ITERATE_DICTIONARY,                     \
 		&&OPCODE_ITERATE_ARRAY,                          \
+		&&OPCODE_ITERATE_TYPED_ARRAY_INT,                \
+		&&OPCODE_ITERATE_TYPED_ARRAY_FLOAT,              \
+		&&OPCODE_ITERATE_TYPED_ARRAY_VECTOR2,            \
+		&&OPCODE_ITERATE_TYPED_ARRAY_VECTOR3,            \
 		&&OPCODE_ITERATE_PACKED_BYTE_ARRAY,              \
 		&&OPCODE_ITERATE_PACKED_INT32_ARRAY,             \
 		&&OPCODE_ITERATE_PACKED_INT64_ARRAY,             \
@@ -3275,6 +3283,39 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_ITERATE_BEGIN_TYPED_ARRAY(m_var_type, m_get_func)                              \
+	OPCODE(OPCODE_ITERATE_BEGIN_TYPED_ARRAY_##m_var_type) {                                   \
+		CHECK_SPACE(8);                                                                       \
+		GET_VARIANT_PTR(counter, 0);                                                          \
+		GET_VARIANT_PTR(container, 1);                                                        \
+		const Array *array = VariantInternal::get_array((const Variant *)container);          \
+		VariantInternal::initialize(counter, Variant::INT);                                   \
+		*VariantInternal::get_int(counter) = 0;                                               \
+		if (!array->is_empty()) {                                                             \
+			GET_VARIANT_PTR(iterator, 2);                                                     \
+			const Variant &elem = (*array)[0];                                                \
+			if (likely(elem.get_type() == Variant::m_var_type)) {                             \
+				VariantInternal::initialize(iterator, Variant::m_var_type);                   \
+				*VariantInternal::m_get_func(iterator) = *VariantInternal::m_get_func(&elem); \
+			} else {                                                                          \
+				*iterator = elem;                                                             \
+			}                                                                                 \
+			ip += 5;                                                                          \
+		} else {                                                                              \
+			int jumpto = _code_ptr[ip + 4];                                                   \
+			GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);                                  \
+			ip = jumpto;                                                                      \
+		}                                                                                     \
+	}                                                                                         \
+	DISPATCH_OPCODE
+
+			// Typed arrays guarantee the element type, so the iterator can be written in place
+			// without going through the generic Variant assignment.
+			OPCODE_ITERATE_BEGIN_TYPED_ARRAY(INT, get_int);
+			OPCODE_ITERATE_BEGIN_TYPED_ARRAY(FLOAT, get_float);
+			OPCODE_ITERATE_BEGIN_TYPED_ARRAY(VECTOR2, get_vector2);
+			OPCODE_ITERATE_BEGIN_TYPED_ARRAY(VECTOR3, get_vector3);
+
 #define OPCODE_ITERATE_BEGIN_PACKED_ARRAY(m_var_type, m_elem_type, m_get_func, m_var_ret_type, m_ret_type, m_ret_get_func) \
 	OPCODE(OPCODE_ITERATE_BEGIN_PACKED_##m_var_type##_ARRAY) {                                                             \
 		CHECK_SPACE(8);                                                                                                    \
@@ -3644,6 +3685,37 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_ITERATE_TYPED_ARRAY(m_var_type, m_get_func)                                    \
+	OPCODE(OPCODE_ITERATE_TYPED_ARRAY_##m_var_type) {                                         \
+		CHECK_SPACE(4);                                                                       \
+		GET_VARIANT_PTR(counter, 0);                                                          \
+		GET_VARIANT_PTR(container, 1);                                                        \
+		const Array *array = VariantInternal::get_array((const Variant *)container);          \
+		int64_t *idx = VariantInternal::get_int(counter);                                     \
+		(*idx)++;                                                                             \
+		if (*idx >= array->size()) {                                                          \
+			int jumpto = _code_ptr[ip + 4];                                                   \
+			GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);                                  \
+			ip = jumpto;                                                                      \
+		} else {                                                                              \
+			GET_VARIANT_PTR(iterator, 2);                                                     \
+			const Variant &elem = (*array)[*idx];                                             \
+			if (likely(elem.get_type() == Variant::m_var_type &&                              \
+						iterator->get_type() == Variant::m_var_type)) {                       \
+				*VariantInternal::m_get_func(iterator) = *VariantInternal::m_get_func(&elem); \
+			} else {                                                                          \
+				*iterator = elem;                                                             \
+			}                                                                                 \
+			ip += 5;                                                                          \
+		}                                                                                     \
+	}                                                                                         \
+	DISPATCH_OPCODE
+
+			OPCODE_ITERATE_TYPED_ARRAY(INT, get_int);
+			OPCODE_ITERATE_TYPED_ARRAY(FLOAT, get_float);
+			OPCODE_ITERATE_TYPED_ARRAY(VECTOR2, get_vector2);
+			OPCODE_ITERATE_TYPED_ARRAY(VECTOR3, get_vector3);
+
 #define OPCODE_ITERATE_PACKED_ARRAY(m_var_type, m_elem_type, m_get_func, m_ret_get_func)            \
 	OPCODE(OPCODE_ITERATE_PACKED_##m_var_type##_ARRAY) {                                            \
 		CHECK_SPACE(4);                                                                             \
@@ -3658,7 +3730,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			ip = jumpto;                                                                            \
 		} else {                                                                                    \
 			GET_VARIANT_PTR(iterator, 2);                                                           \
-			*VariantInternal::m_ret_get_func(iterator) = array->get(*idx);                          \
+			*VariantInternal::m_ret_get_func(iterator) = array->ptr()[*idx];                        \
 			ip += 5;                                                                                \
 		}                                                                                           \
 	}                                                                                               \
@@ -3875,6 +3947,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE(OPCODE_LINE) {
 				CHECK_SPACE(2);
 
+#ifdef DEBUG_ENABLED
+				// Time elapsed since the last sample was spent on the previous line.
+				GDScriptLanguage::get_singleton()->sampling_poll();
+#endif
+
 				line = _code_ptr[ip + 1];
 				ip += 2;
 
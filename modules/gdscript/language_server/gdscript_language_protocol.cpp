@@ -31,6 +31,7 @@
 #include "gdscript_language_protocol.h"
 
 #include "core/config/project_settings.h"
+#include "core/io/json.h"
 #include "editor/doc/doc_tools.h"
 #include "editor/doc/editor_help.h"
 #include "editor/editor_log.h"
@@ -137,13 +138,45 @@ void GDScriptLanguageProtocol::on_client_disconnected(const int &p_client_id) {
 	EditorNode::get_log()->add_message("[LSP] Disconnected", EditorLog::MSG_TYPE_EDITOR);
 }
 
+static bool _is_did_change_message(const Variant &p_message) {
+	if (p_message.get_type() != Variant::DICTIONARY) {
+		return false;
+	}
+	const Variant method = Dictionary(p_message).get("method", Variant());
+	return method.get_type() == Variant::STRING && String(method) == "textDocument/didChange";
+}
+
 String GDScriptLanguageProtocol::process_message(const String &p_text) {
-	String ret = process_string(p_text);
-	if (ret.is_empty()) {
-		return ret;
-	} else {
-		return format_output(ret);
+	if (p_text.is_empty()) {
+		return String();
+	}
+
+	// Parse here rather than in process_string(), so the method can be inspected before processing.
+	JSON json;
+	if (json.parse(p_text) != OK) {
+		workspace->flush_pending_scripts();
+		return format_output(Variant(make_response_error(JSONRPC::PARSE_ERROR, "Parse error")).to_json_string());
 	}
+	const Variant message = json.get_data();
+
+	bool only_did_change = _is_did_change_message(message);
+	if (message.get_type() == Variant::ARRAY) {
+		const Array batch = message;
+		only_did_change = !batch.is_empty();
+		for (const Variant &batch_message : batch) {
+			only_did_change = only_did_change && _is_did_change_message(batch_message);
+		}
+	}
+	if (!only_did_change) {
+		// Any other message may read parse results, so apply the queued edits first.
+		workspace->flush_pending_scripts();
+	}
+
+	const Variant ret = process_action(message, true);
+	if (ret.get_type() == Variant::NIL) {
+		return String();
+	}
+	return format_output(ret.to_json_string());
 }
 
 String GDScriptLanguageProtocol::format_output(const String &p_text) {
@@ -290,6 +323,9 @@ void GDScriptLanguageProtocol::poll(int p_limit_usec) {
 		}
 		++E;
 	}
+
+	// Publish diagnostics for edits that were not followed by another request.
+	workspace->flush_pending_scripts();
 }
 
 Error GDScriptLanguageProtocol::start(int p_port, const IPAddress &p_bind_ip) {
@@ -81,7 +81,10 @@ void GDScriptTextDocument::didChange(const Variant &p_param) {
 		evt.load(contentChanges[i]);
 		doc.text = evt.text;
 	}
-	sync_script_content(doc.uri, doc.text);
+	// Editors send a change per keystroke; only the latest content is parsed, right
+	// before the next request that needs it (see GDScriptLanguageProtocol::process_message).
+	String path = GDScriptLanguageProtocol::get_singleton()->get_workspace()->get_file_path(doc.uri);
+	GDScriptLanguageProtocol::get_singleton()->get_workspace()->queue_script_parse(path, doc.text);
 }
 
 void GDScriptTextDocument::willSaveWaitUntil(const Variant &p_param) {
@@ -440,7 +440,24 @@ Error GDScriptWorkspace::initialize() {
 	return OK;
 }
 
+void GDScriptWorkspace::queue_script_parse(const String &p_path, const String &p_content) {
+	pending_scripts[p_path] = p_content;
+}
+
+void GDScriptWorkspace::flush_pending_scripts() {
+	while (!pending_scripts.is_empty()) {
+		HashMap<String, String>::Iterator E = pending_scripts.begin();
+		const String path = E->key;
+		const String content = E->value;
+		pending_scripts.remove(E);
+		parse_script(path, content);
+	}
+}
+
 Error GDScriptWorkspace::parse_script(const String &p_path, const String &p_content) {
+	// Parsing the full content supersedes any queued edit.
+	pending_scripts.erase(p_path);
+
 	ExtendGDScriptParser *parser = memnew(ExtendGDScriptParser);
 	Error err = parser->parse(p_content, p_path);
 	HashMap<String, ExtendGDScriptParser *>::Iterator last_parser = parse_results.find(p_path);
@@ -75,11 +75,16 @@ public:
 	HashMap<String, ExtendGDScriptParser *> parse_results;
 	HashMap<StringName, ClassMembers> native_members;
 
+	// Latest unparsed content per script, so consecutive edits are parsed only once.
+	HashMap<String, String> pending_scripts;
+
 public:
 	Error initialize();
 
 	Error parse_script(const String &p_path, const String &p_content);
 	Error parse_local_script(const String &p_path);
+	void queue_script_parse(const String &p_path, const String &p_content);
+	void flush_pending_scripts();
 
 	String get_file_path(const String &p_uri);
 	String get_file_uri(const String &p_path) const;
@@ -72,6 +72,41 @@ func _init():
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Modules][GDScript] Sampling profiler weights samples by elapsed time") {
+	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
+	lang->init();
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+func wait():
+	OS.delay_msec(200)
+	return 1
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+
+	lang->sampling_start(100);
+	ref_counted->call("wait");
+	lang->sampling_stop();
+
+	// The native call only returns once, but every tick spent in it must be attributed to its line.
+	uint64_t delay_line_samples = 0;
+	for (const String &line : lang->sampling_get_folded_stacks().split("\n", false)) {
+		if (line.get_slice(" ", line.get_slice_count(" ") - 2).ends_with(":5)")) {
+			delay_line_samples += line.get_slice(" ", line.get_slice_count(" ") - 1).to_int();
+		}
+	}
+	CHECK_MESSAGE(delay_line_samples >= 5, "Samples should be proportional to the time spent on a line.");
+}
+#endif // DEBUG_ENABLED
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
@@ -0,0 +1,35 @@
+func test():
+	var ints: Array[int] = [1, 2, 3]
+	var int_sum := 0
+	for i in ints:
+		int_sum += i
+	print(int_sum)
+
+	var floats: Array[float] = [0.5, 1.5, 2]
+	var float_sum := 0.0
+	for f in floats:
+		float_sum += f
+	print(float_sum)
+
+	var points: Array[Vector2] = [Vector2(1, 2), Vector2(3, 4)]
+	var point_sum := Vector2()
+	for p in points:
+		point_sum += p
+	print(point_sum)
+
+	var positions: Array[Vector3] = [Vector3(1, 0, 0), Vector3(0, 1, 0), Vector3(0, 0, 1)]
+	var position_sum := Vector3()
+	for p in positions:
+		position_sum += p
+	print(position_sum)
+
+	var empty: Array[int] = []
+	for i in empty:
+		print("unreachable")
+
+	for i in ints:
+		print(typeof(i) == TYPE_INT)
+
+	var packed := PackedFloat32Array([1.0, 2.0])
+	for f in packed:
+		print(f)
@@ -526,6 +526,36 @@ func f():
 			REQUIRE(cls.documentation.contains("t3"));
 		}
 
+		memdelete(proto);
+		memdelete(efs);
+		finish_language();
+	}
+	TEST_CASE("[workspace][queue_script_parse]") {
+		EditorFileSystem *efs = memnew(EditorFileSystem);
+		GDScriptLanguageProtocol *proto = initialize(root);
+		REQUIRE(proto);
+
+		Ref<GDScriptWorkspace> workspace = GDScriptLanguageProtocol::get_singleton()->get_workspace();
+		const String path = "res://lsp/queued_edit.gd";
+
+		workspace->queue_script_parse(path, "var first = 1\n");
+		workspace->queue_script_parse(path, "var second = 2\n");
+		CHECK_FALSE(workspace->parse_results.has(path));
+		CHECK_EQ(workspace->pending_scripts.size(), 1);
+
+		workspace->flush_pending_scripts();
+		CHECK(workspace->pending_scripts.is_empty());
+		ExtendGDScriptParser *parser = workspace->parse_results[path];
+		REQUIRE(parser);
+		CHECK_EQ(parser->get_lines()[0], "var second = 2");
+
+		workspace->queue_script_parse(path, "var third = 3\n");
+		workspace->parse_script(path, "var fourth = 4\n");
+		CHECK(workspace->pending_scripts.is_empty());
+		parser = workspace->parse_results[path];
+		REQUIRE(parser);
+		CHECK_EQ(parser->get_lines()[0], "var fourth = 4");
+
 		memdelete(proto);
 		memdelete(efs);
 		finish_language();
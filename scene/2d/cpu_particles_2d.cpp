@@ -33,6 +33,7 @@
 
 #include "core/math/random_number_generator.h"
 #include "core/math/transform_interpolator.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/2d/gpu_particles_2d.h"
 #include "scene/resources/atlas_texture.h"
 #include "scene/resources/canvas_item_material.h"
@@ -1128,42 +1129,21 @@ void CPUParticles2D::_particles_process(double p_delta) {
 	}
 }
 
-void CPUParticles2D::_update_particle_data_buffer() {
-	MutexLock lock(update_mutex);
-
-	int pc = particles.size();
-
-	int *ow;
-	int *order = nullptr;
-
-	float *w = particle_data.ptrw();
-	const Particle *r = particles.ptr();
-	float *ptr = w;
-
-	if (draw_order != DRAW_ORDER_INDEX) {
-		ow = particle_order.ptrw();
-		order = ow;
+void CPUParticles2D::_write_particle_data(uint32_t p_chunk, ParticleDataWrite *p_write) {
+	const int from = p_chunk * PARTICLE_DATA_CHUNK_SIZE;
+	const int to = MIN(from + PARTICLE_DATA_CHUNK_SIZE, p_write->count);
+	float *ptr = p_write->data + from * 16;
 
-		for (int i = 0; i < pc; i++) {
-			order[i] = i;
-		}
-		if (draw_order == DRAW_ORDER_LIFETIME) {
-			SortArray<int, SortLifetime> sorter;
-			sorter.compare.particles = r;
-			sorter.sort(order, pc);
-		}
-	}
+	for (int i = from; i < to; i++) {
+		const Particle &p = p_write->particles[p_write->order ? p_write->order[i] : i];
 
-	for (int i = 0; i < pc; i++) {
-		int idx = order ? order[i] : i;
-
-		Transform2D t = r[idx].transform;
+		Transform2D t = p.transform;
 
 		if (!local_coords) {
 			t = inv_emission_transform * t;
 		}
 
-		if (r[idx].active) {
+		if (p.active) {
 			ptr[0] = t.columns[0][0];
 			ptr[1] = t.columns[1][0];
 			ptr[2] = 0;
@@ -1177,22 +1157,63 @@ void CPUParticles2D::_update_particle_data_buffer() {
 			memset(ptr, 0, sizeof(float) * 8);
 		}
 
-		Color c = r[idx].color;
+		Color c = p.color;
 
 		ptr[8] = c.r;
 		ptr[9] = c.g;
 		ptr[10] = c.b;
 		ptr[11] = c.a;
 
-		ptr[12] = r[idx].custom[0];
-		ptr[13] = r[idx].custom[1];
-		ptr[14] = r[idx].custom[2];
-		ptr[15] = r[idx].custom[3];
+		ptr[12] = p.custom[0];
+		ptr[13] = p.custom[1];
+		ptr[14] = p.custom[2];
+		ptr[15] = p.custom[3];
 
 		ptr += 16;
 	}
 }
 
+void CPUParticles2D::_update_particle_data_buffer() {
+	MutexLock lock(update_mutex);
+
+	int pc = particles.size();
+
+	int *ow;
+	int *order = nullptr;
+
+	float *w = particle_data.ptrw();
+	const Particle *r = particles.ptr();
+
+	if (draw_order != DRAW_ORDER_INDEX) {
+		ow = particle_order.ptrw();
+		order = ow;
+
+		for (int i = 0; i < pc; i++) {
+			order[i] = i;
+		}
+		if (draw_order == DRAW_ORDER_LIFETIME) {
+			SortArray<int, SortLifetime> sorter;
+			sorter.compare.particles = r;
+			sorter.sort(order, pc);
+		}
+	}
+
+	ParticleDataWrite write;
+	write.data = w;
+	write.particles = r;
+	write.order = order;
+	write.count = pc;
+
+	// Each particle writes its own slot, so large emitters fill the buffer in parallel chunks.
+	const int chunk_count = (pc + PARTICLE_DATA_CHUNK_SIZE - 1) / PARTICLE_DATA_CHUNK_SIZE;
+	if (chunk_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles2D::_write_particle_data, &write, chunk_count, -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (chunk_count == 1) {
+		_write_particle_data(0, &write);
+	}
+}
+
 void CPUParticles2D::_set_do_redraw(bool p_do_redraw) {
 	if (do_redraw == p_do_redraw) {
 		return;
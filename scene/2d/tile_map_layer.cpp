@@ -33,6 +33,7 @@
 #include "core/io/marshalls.h"
 #include "core/math/geometry_2d.h"
 #include "core/math/random_pcg.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/a_hash_map.h"
 #include "scene/2d/tile_map.h"
 #include "scene/gui/control.h"
@@ -764,6 +765,9 @@ void TileMapLayer::_physics_update(bool p_force_cleanup) {
 			}
 		}
 
+		// Bodies whose polygons must be merged, filled while updating the dirty quadrants.
+		LocalVector<PhysicsBodyMerge> body_merges;
+
 		// Update all dirty quadrants.
 		for (SelfList<PhysicsQuadrant> *quadrant_list_element = dirty_physics_quadrant_list.first(); quadrant_list_element;) {
 			SelfList<PhysicsQuadrant> *next_quadrant_list_element = quadrant_list_element->next(); // "Hack" to clear the list while iterating.
@@ -825,6 +829,7 @@ void TileMapLayer::_physics_update(bool p_force_cleanup) {
 
 						Vector2 linear_velocity = tile_data->get_constant_linear_velocity(tile_set_physics_layer);
 						real_t angular_velocity = tile_data->get_constant_angular_velocity(tile_set_physics_layer);
+						Vector2 cell_offset = tile_set->map_to_local(cell_data.coords) - quadrant_origin;
 
 						// Setup polygons for merge.
 						for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
@@ -839,10 +844,11 @@ void TileMapLayer::_physics_update(bool p_force_cleanup) {
 							physics_body_key.one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
 							physics_body_key.one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
 
-							if (!physics_quadrant->bodies.has(physics_body_key)) {
+							HashMap<PhysicsQuadrant::PhysicsBodyKey, PhysicsQuadrant::PhysicsBodyValue, PhysicsQuadrant::PhysicsBodyKeyHasher>::Iterator body_it = physics_quadrant->bodies.find(physics_body_key);
+							if (!body_it) {
 								RID body = ps->body_create();
-								physics_quadrant->bodies[physics_body_key] = {};
-								physics_quadrant->bodies[physics_body_key].body = body;
+								body_it = physics_quadrant->bodies.insert(physics_body_key, PhysicsQuadrant::PhysicsBodyValue());
+								body_it->value.body = body;
 								bodies_coords[body] = physics_quadrant->quadrant_coords;
 
 								// Create or update the body.
@@ -875,34 +881,24 @@ void TileMapLayer::_physics_update(bool p_force_cleanup) {
 
 								// Translate the polygon.
 								Vector<Vector2> convex_polygon = shape->get_points();
+								Vector2 *convex_polygon_ptrw = convex_polygon.ptrw();
 								for (int i = 0; i < convex_polygon.size(); i++) {
-									convex_polygon.set(i, convex_polygon[i] + tile_set->map_to_local(cell_data.coords) - quadrant_origin);
+									convex_polygon_ptrw[i] += cell_offset;
 								}
 
-								physics_quadrant->bodies[physics_body_key].polygons.push_back(convex_polygon);
+								body_it->value.polygons.push_back(convex_polygon);
 							}
 						}
 					}
 				}
 
-				// Iterate over the bodies
-				for (const KeyValue<PhysicsQuadrant::PhysicsBodyKey, PhysicsQuadrant::PhysicsBodyValue> &kvbody : physics_quadrant->bodies) {
-					// Actually merge the polygons.
-					Vector<Vector<Vector2>> out_polygons;
-					Vector<Vector<Vector2>> out_holes;
-					Geometry2D::merge_many_polygons(kvbody.value.polygons, out_polygons, out_holes);
-					// Create shapes for each polygon.
-					int body_shape_index = 0;
-					Vector<Vector<Vector2>> convex_polygons = Geometry2D::decompose_many_polygons_in_convex(out_polygons, out_holes);
-					for (Vector<Vector2> &convex_polygon : convex_polygons) {
-						Ref<ConvexPolygonShape2D> shape;
-						shape.instantiate();
-						shape->set_points(convex_polygon);
-						ps->body_add_shape(kvbody.value.body, shape->get_rid());
-						ps->body_set_shape_as_one_way_collision(kvbody.value.body, body_shape_index, kvbody.key.one_way_collision, kvbody.key.one_way_collision_margin);
-						physics_quadrant->shapes.push_back(shape);
-						body_shape_index++;
-					}
+				// Queue the bodies for polygon merging. The quadrant stays in the map, so those pointers remain valid.
+				for (KeyValue<PhysicsQuadrant::PhysicsBodyKey, PhysicsQuadrant::PhysicsBodyValue> &kvbody : physics_quadrant->bodies) {
+					PhysicsBodyMerge body_merge;
+					body_merge.quadrant = physics_quadrant.ptr();
+					body_merge.key = &kvbody.key;
+					body_merge.value = &kvbody.value;
+					body_merges.push_back(body_merge);
 				}
 			} else {
 				// Free the quadrant.
@@ -923,6 +919,28 @@ void TileMapLayer::_physics_update(bool p_force_cleanup) {
 
 		dirty_physics_quadrant_list.clear();
 
+		// Merge the polygons of each body. This only touches geometry, so it can run on worker threads.
+		if (body_merges.size() > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &TileMapLayer::_physics_merge_body_polygons, body_merges.ptr(), body_merges.size(), -1, true, SNAME("TileMapLayerPhysicsMerge"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else if (body_merges.size() == 1) {
+			_physics_merge_body_polygons(0, body_merges.ptr());
+		}
+
+		// Create shapes for each merged polygon.
+		for (const PhysicsBodyMerge &body_merge : body_merges) {
+			int body_shape_index = 0;
+			for (const Vector<Vector2> &convex_polygon : body_merge.convex_polygons) {
+				Ref<ConvexPolygonShape2D> shape;
+				shape.instantiate();
+				shape->set_points(convex_polygon);
+				ps->body_add_shape(body_merge.value->body, shape->get_rid());
+				ps->body_set_shape_as_one_way_collision(body_merge.value->body, body_shape_index, body_merge.key->one_way_collision, body_merge.key->one_way_collision_margin);
+				body_merge.quadrant->shapes.push_back(shape);
+				body_shape_index++;
+			}
+		}
+
 		// Updates on physics changes.
 		if (dirty.flags[DIRTY_FLAGS_LAYER_USE_KINEMATIC_BODIES]) {
 			for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
@@ -939,6 +957,15 @@ void TileMapLayer::_physics_update(bool p_force_cleanup) {
 	_physics_was_cleaned_up = forced_cleanup || !occlusion_enabled;
 }
 
+void TileMapLayer::_physics_merge_body_polygons(uint32_t p_index, PhysicsBodyMerge *p_body_merges) {
+	PhysicsBodyMerge &body_merge = p_body_merges[p_index];
+
+	Vector<Vector<Vector2>> out_polygons;
+	Vector<Vector<Vector2>> out_holes;
+	Geometry2D::merge_many_polygons(body_merge.value->polygons, out_polygons, out_holes);
+	body_merge.convex_polygons = Geometry2D::decompose_many_polygons_in_convex(out_polygons, out_holes);
+}
+
 void TileMapLayer::_physics_quadrants_update_cell(CellData &r_cell_data, SelfList<PhysicsQuadrant>::List &r_dirty_physics_quadrant_list) {
 	// Check if the cell is valid and retrieve its y_sort_origin.
 	bool is_valid = false;
@@ -451,7 +451,14 @@ private:
 	HashMap<Vector2i, Ref<PhysicsQuadrant>> physics_quadrant_map;
 	HashMap<RID, Vector2i> bodies_coords; // Mapping for RID to coords.
 	bool _physics_was_cleaned_up = false;
+	struct PhysicsBodyMerge {
+		PhysicsQuadrant *quadrant = nullptr;
+		const PhysicsQuadrant::PhysicsBodyKey *key = nullptr;
+		const PhysicsQuadrant::PhysicsBodyValue *value = nullptr;
+		Vector<Vector<Vector2>> convex_polygons;
+	};
 	void _physics_update(bool p_force_cleanup);
+	void _physics_merge_body_polygons(uint32_t p_index, PhysicsBodyMerge *p_body_merges);
 	void _physics_notification(int p_what);
 	void _physics_quadrants_update_cell(CellData &r_cell_data, SelfList<PhysicsQuadrant>::List &r_dirty_physics_quadrant_list);
 	void _physics_clear_cell(CellData &r_cell_data);
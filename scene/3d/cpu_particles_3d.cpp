@@ -32,6 +32,7 @@
 #include "cpu_particles_3d.compat.inc"
 
 #include "core/math/random_number_generator.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/camera_3d.h"
 #include "scene/3d/gpu_particles_3d.h"
 #include "scene/main/viewport.h"
@@ -1227,6 +1228,53 @@ void CPUParticles3D::_particles_process(double p_delta) {
 	}
 }
 
+void CPUParticles3D::_write_particle_data(uint32_t p_chunk, ParticleDataWrite *p_write) {
+	const int from = p_chunk * PARTICLE_DATA_CHUNK_SIZE;
+	const int to = MIN(from + PARTICLE_DATA_CHUNK_SIZE, p_write->count);
+	float *ptr = p_write->data + from * 20;
+
+	for (int i = from; i < to; i++) {
+		const Particle &p = p_write->particles[p_write->order ? p_write->order[i] : i];
+
+		Transform3D t = p.transform;
+
+		if (!local_coords) {
+			t = inv_emission_transform * t;
+		}
+
+		if (p.active) {
+			ptr[0] = t.basis.rows[0][0];
+			ptr[1] = t.basis.rows[0][1];
+			ptr[2] = t.basis.rows[0][2];
+			ptr[3] = t.origin.x;
+			ptr[4] = t.basis.rows[1][0];
+			ptr[5] = t.basis.rows[1][1];
+			ptr[6] = t.basis.rows[1][2];
+			ptr[7] = t.origin.y;
+			ptr[8] = t.basis.rows[2][0];
+			ptr[9] = t.basis.rows[2][1];
+			ptr[10] = t.basis.rows[2][2];
+			ptr[11] = t.origin.z;
+		} else {
+			memset(ptr, 0, sizeof(float) * 12);
+		}
+
+		Color c = p.color;
+
+		ptr[12] = c.r;
+		ptr[13] = c.g;
+		ptr[14] = c.b;
+		ptr[15] = c.a;
+
+		ptr[16] = p.custom[0];
+		ptr[17] = p.custom[1];
+		ptr[18] = p.custom[2];
+		ptr[19] = p.custom[3];
+
+		ptr += 20;
+	}
+}
+
 void CPUParticles3D::_update_particle_data_buffer() {
 	MutexLock lock(update_mutex);
 
@@ -1237,7 +1285,6 @@ void CPUParticles3D::_update_particle_data_buffer() {
 
 	float *w = particle_data.ptrw();
 	const Particle *r = particles.ptr();
-	float *ptr = w;
 
 	if (draw_order != DRAW_ORDER_INDEX) {
 		ow = particle_order.ptrw();
@@ -1272,45 +1319,19 @@ void CPUParticles3D::_update_particle_data_buffer() {
 		}
 	}
 
-	for (int i = 0; i < pc; i++) {
-		int idx = order ? order[i] : i;
-
-		Transform3D t = r[idx].transform;
-
-		if (!local_coords) {
-			t = inv_emission_transform * t;
-		}
-
-		if (r[idx].active) {
-			ptr[0] = t.basis.rows[0][0];
-			ptr[1] = t.basis.rows[0][1];
-			ptr[2] = t.basis.rows[0][2];
-			ptr[3] = t.origin.x;
-			ptr[4] = t.basis.rows[1][0];
-			ptr[5] = t.basis.rows[1][1];
-			ptr[6] = t.basis.rows[1][2];
-			ptr[7] = t.origin.y;
-			ptr[8] = t.basis.rows[2][0];
-			ptr[9] = t.basis.rows[2][1];
-			ptr[10] = t.basis.rows[2][2];
-			ptr[11] = t.origin.z;
-		} else {
-			memset(ptr, 0, sizeof(float) * 12);
-		}
-
-		Color c = r[idx].color;
-
-		ptr[12] = c.r;
-		ptr[13] = c.g;
-		ptr[14] = c.b;
-		ptr[15] = c.a;
-
-		ptr[16] = r[idx].custom[0];
-		ptr[17] = r[idx].custom[1];
-		ptr[18] = r[idx].custom[2];
-		ptr[19] = r[idx].custom[3];
-
-		ptr += 20;
+	ParticleDataWrite write;
+	write.data = w;
+	write.particles = r;
+	write.order = order;
+	write.count = pc;
+
+	// Each particle writes its own slot, so large emitters fill the buffer in parallel chunks.
+	const int chunk_count = (pc + PARTICLE_DATA_CHUNK_SIZE - 1) / PARTICLE_DATA_CHUNK_SIZE;
+	if (chunk_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles3D::_write_particle_data, &write, chunk_count, -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (chunk_count == 1) {
+		_write_particle_data(0, &write);
 	}
 
 	can_update.set();
@@ -195,6 +195,17 @@ private:
 
 	void _update_internal();
 	void _particles_process(double p_delta);
+
+	static constexpr int PARTICLE_DATA_CHUNK_SIZE = 2048;
+
+	struct ParticleDataWrite {
+		float *data = nullptr;
+		const Particle *particles = nullptr;
+		const int *order = nullptr;
+		int count = 0;
+	};
+
+	void _write_particle_data(uint32_t p_chunk, ParticleDataWrite *p_write);
 	void _update_particle_data_buffer();
 	void _set_emitting();
 
@@ -79,7 +79,7 @@ void Node3D::_notify_dirty() {
 	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
 
 #endif
-		get_tree()->xform_change_list.add(&xform_change);
+		get_tree()->_add_xform_change(&xform_change);
 	}
 }
 
@@ -99,20 +99,30 @@ void Node3D::_update_rotation_and_scale() const {
 
 void Node3D::_propagate_transform_changed_deferred() {
 	if (is_inside_tree() && !xform_change.in_list()) {
-		get_tree()->xform_change_list.add(&xform_change);
+		get_tree()->_add_xform_change(&xform_change);
 	}
 }
 
-void Node3D::_propagate_transform_changed(Node3D *p_origin) {
+bool Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	if (!is_inside_tree()) {
-		return;
+		return false;
 	}
 
+	const uint32_t epoch = get_tree()->xform_change_epoch.get();
+	bool complete = !data.ignore_notification;
+
 	for (Node3D *&E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
 		}
-		E->_propagate_transform_changed(p_origin);
+		// A child that is still dirty from a propagation in this epoch already has its whole subtree
+		// dirty and queued for notification, so walking it again would change nothing.
+		if (E->data.xform_propagation_epoch.get() == epoch && E->_test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+			continue;
+		}
+		if (!E->_propagate_transform_changed(p_origin)) {
+			complete = false;
+		}
 	}
 #ifdef TOOLS_ENABLED
 	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
@@ -120,13 +130,25 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
 #endif
 		if (likely(is_accessible_from_caller_thread())) {
-			get_tree()->xform_change_list.add(&xform_change);
+			get_tree()->_add_xform_change(&xform_change);
 		} else {
 			// This should very rarely happen, but if it does at least make sure the notification is received eventually.
 			callable_mp(this, &Node3D::_propagate_transform_changed_deferred).call_deferred();
 		}
 	}
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM);
+	// A node ignoring notifications was not queued, so it and all of its ancestors up to the origin
+	// must be visited again by the next propagation, otherwise the skip above would hide it.
+	data.xform_propagation_epoch.set(complete ? epoch : 0);
+	return complete;
+}
+
+void Node3D::_invalidate_transform_propagation() {
+	// Called when a node starts wanting notifications or leaves xform_change_list outside of a flush,
+	// so that subtrees skipped by _propagate_transform_changed() are walked again.
+	if (is_inside_tree()) {
+		get_tree()->xform_change_epoch.increment();
+	}
 }
 
 void Node3D::_notification(int p_what) {
@@ -200,7 +222,7 @@ void Node3D::_notification(int p_what) {
 
 			notification(NOTIFICATION_EXIT_WORLD, true);
 			if (xform_change.in_list()) {
-				get_tree()->xform_change_list.remove(&xform_change);
+				get_tree()->_remove_xform_change(&xform_change);
 			}
 			if (data.C) {
 				data.parent->data.children.erase(data.C);
@@ -893,6 +915,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_transform_propagation();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -1250,6 +1273,9 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
+	if (p_enabled && !data.notify_transform) {
+		_invalidate_transform_propagation();
+	}
 	data.notify_transform = p_enabled;
 }
 
@@ -1274,7 +1300,8 @@ void Node3D::force_update_transform() {
 	if (!xform_change.in_list()) {
 		return; //nothing to update
 	}
-	get_tree()->xform_change_list.remove(&xform_change);
+	get_tree()->_remove_xform_change(&xform_change);
+	_invalidate_transform_propagation();
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
@@ -153,6 +153,10 @@ private:
 		List<Node3D *> children;
 		List<Node3D *>::Element *C = nullptr;
 
+		// SceneTree::xform_change_epoch at the time this subtree was last fully propagated.
+		// Propagation from a process group thread can reach children owned by other groups, so it's atomic.
+		SafeNumeric<uint32_t> xform_propagation_epoch;
+
 		ClientPhysicsInterpolationData *client_physics_interpolation_data = nullptr;
 
 #ifdef TOOLS_ENABLED
@@ -175,7 +179,8 @@ private:
 
 	void _update_gizmos();
 	void _notify_dirty();
-	void _propagate_transform_changed(Node3D *p_origin);
+	bool _propagate_transform_changed(Node3D *p_origin); // Returns whether the whole subtree was queued for notification.
+	void _invalidate_transform_propagation();
 
 	void _propagate_visibility_changed();
 
@@ -364,16 +364,10 @@ void Skeleton3D::_notification(int p_what) {
 
 						if (bind_name != StringName()) {
 							// Bind name used, use this.
-							bool found = false;
-							for (int j = 0; j < len; j++) {
-								if (bonesptr[j].name == bind_name) {
-									E->skin_bone_indices_ptrs[i] = j;
-									found = true;
-									break;
-								}
-							}
-
-							if (!found) {
+							int bind_index = find_bone(bind_name);
+							if (bind_index >= 0) {
+								E->skin_bone_indices_ptrs[i] = bind_index;
+							} else {
 								ERR_PRINT("Skin bind #" + itos(i) + " contains named bind '" + String(bind_name) + "' but Skeleton3D has no bone by that name.");
 								E->skin_bone_indices_ptrs[i] = 0;
 							}
@@ -1059,9 +1053,8 @@ void Skeleton3D::force_update_all_bone_transforms() {
 
 void Skeleton3D::_force_update_all_bone_transforms() const {
 	_update_process_order();
-	for (int i = 0; i < parentless_bones.size(); i++) {
-		_force_update_bone_children_transforms(parentless_bones[i]);
-	}
+	// A single pass over the nested set updates every tree, parents before children.
+	_update_dirty_bone_transforms();
 	if (rest_dirty) {
 		rest_dirty = false;
 		const_cast<Skeleton3D *>(this)->emit_signal(SNAME("rest_updated"));
@@ -1084,7 +1077,11 @@ void Skeleton3D::_force_update_bone_children_transforms(int p_bone_idx) const {
 	ERR_FAIL_INDEX(p_bone_idx, bone_size);
 
 	_update_process_order();
+	_update_dirty_bone_transforms();
+}
 
+void Skeleton3D::_update_dirty_bone_transforms() const {
+	const int bone_size = bones.size();
 	Bone *bonesptr = bones.ptr();
 
 	// Loop through nested set.
@@ -290,6 +290,7 @@ public:
 	void _force_update_all_bone_transforms() const;
 	void force_update_bone_children_transforms(int bone_idx);
 	void _force_update_bone_children_transforms(int bone_idx) const;
+	void _update_dirty_bone_transforms() const;
 	void force_update_deferred();
 
 	void set_modifier_callback_mode_process(ModifierCallbackModeProcess p_mode);
@@ -1638,7 +1638,7 @@ void SpringBoneSimulator3D::_process_modification(double p_delta) {
 
 	for (int i = 0; i < settings.size(); i++) {
 		_init_joints(skeleton, settings[i]);
-		_process_joints(p_delta, skeleton, settings[i]->joints, get_valid_collision_instance_ids(i), settings[i]->cached_center, settings[i]->cached_inverted_center, settings[i]->cached_inverted_center.basis.get_rotation_quaternion());
+		_process_joints(p_delta, skeleton, settings[i]->joints, settings[i]->cached_collisions, settings[i]->cached_center, settings[i]->cached_inverted_center, settings[i]->cached_inverted_center.basis.get_rotation_quaternion());
 	}
 }
 
@@ -1714,6 +1714,17 @@ void SpringBoneSimulator3D::_init_joints(Skeleton3D *p_skeleton, SpringBone3DSet
 }
 
 void SpringBoneSimulator3D::_process_joints(double p_delta, Skeleton3D *p_skeleton, Vector<SpringBone3DJointSetting *> &p_joints, const LocalVector<ObjectID> &p_collisions, const Transform3D &p_center_transform, const Transform3D &p_inverted_center_transform, const Quaternion &p_inverted_center_rotation) {
+	// Resolve the colliders and the chain-wide rotations once instead of for every joint.
+	thread_local LocalVector<SpringBoneCollision3D *> colliders;
+	colliders.clear();
+	for (const ObjectID &oid : p_collisions) {
+		SpringBoneCollision3D *col = ObjectDB::get_instance<SpringBoneCollision3D>(oid);
+		if (col) {
+			colliders.push_back(col);
+		}
+	}
+	const Quaternion center_rotation = p_center_transform.basis.get_rotation_quaternion();
+
 	for (int i = 0; i < p_joints.size(); i++) {
 		SpringBone3DVerletInfo *verlet = p_joints[i]->verlet;
 		if (!verlet) {
@@ -1725,34 +1736,31 @@ void SpringBoneSimulator3D::_process_joints(double p_delta, Skeleton3D *p_skelet
 		Vector3 current_origin = p_center_transform.xform(current_global_pose.origin);
 		Vector3 external = p_inverted_center_rotation.xform((external_force + p_joints[i]->gravity_direction * p_joints[i]->gravity) * p_delta);
 
+		const bool axis_locked = p_joints[i]->rotation_axis != ROTATION_AXIS_ALL;
+		const Vector3 axis_vector = axis_locked ? p_joints[i]->get_rotation_axis_vector() : Vector3();
+		const Quaternion world_rot = axis_locked ? current_world_pose.basis.get_rotation_quaternion() : Quaternion();
+
 		// Integration of velocity by verlet.
 		Vector3 next_tail = verlet->current_tail +
 				(verlet->current_tail - verlet->prev_tail) * (1.0 - p_joints[i]->drag) +
-				p_center_transform.basis.get_rotation_quaternion().xform(current_rot.xform(verlet->forward_vector * (p_joints[i]->stiffness * p_delta)) + external);
+				center_rotation.xform(current_rot.xform(verlet->forward_vector * (p_joints[i]->stiffness * p_delta)) + external);
 		// Snap to plane if axis locked.
-		if (p_joints[i]->rotation_axis != ROTATION_AXIS_ALL) {
-			next_tail = current_world_pose.origin + current_world_pose.basis.get_rotation_quaternion().xform(snap_vector_to_plane(p_joints[i]->get_rotation_axis_vector(), current_world_pose.basis.get_rotation_quaternion().xform_inv(next_tail - current_world_pose.origin)));
+		if (axis_locked) {
+			next_tail = current_world_pose.origin + world_rot.xform(snap_vector_to_plane(axis_vector, world_rot.xform_inv(next_tail - current_world_pose.origin)));
 		}
 		// Limit bone length.
 		next_tail = limit_length(current_origin, next_tail, verlet->length);
 
 		// Collision movement.
-		for (uint32_t j = 0; j < p_collisions.size(); j++) {
-			Object *obj = ObjectDB::get_instance(p_collisions[j]);
-			if (!obj) {
-				continue;
-			}
-			SpringBoneCollision3D *col = Object::cast_to<SpringBoneCollision3D>(obj);
-			if (col) {
-				// Collider movement should separate from the effect of the center.
-				next_tail = col->collide(p_center_transform, p_joints[i]->radius, verlet->length, next_tail);
-				// Snap to plane if axis locked.
-				if (p_joints[i]->rotation_axis != ROTATION_AXIS_ALL) {
-					next_tail = current_world_pose.origin + current_world_pose.basis.get_rotation_quaternion().xform(snap_vector_to_plane(p_joints[i]->get_rotation_axis_vector(), current_world_pose.basis.get_rotation_quaternion().xform_inv(next_tail - current_world_pose.origin)));
-				}
-				// Limit bone length.
-				next_tail = limit_length(current_origin, next_tail, verlet->length);
+		for (SpringBoneCollision3D *col : colliders) {
+			// Collider movement should separate from the effect of the center.
+			next_tail = col->collide(p_center_transform, p_joints[i]->radius, verlet->length, next_tail);
+			// Snap to plane if axis locked.
+			if (axis_locked) {
+				next_tail = current_world_pose.origin + world_rot.xform(snap_vector_to_plane(axis_vector, world_rot.xform_inv(next_tail - current_world_pose.origin)));
 			}
+			// Limit bone length.
+			next_tail = limit_length(current_origin, next_tail, verlet->length);
 		}
 
 		// Store current tails for next process.
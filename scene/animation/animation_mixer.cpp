@@ -891,6 +891,7 @@ bool AnimationMixer::_update_caches() {
 					}
 				}
 				track->path = path;
+				track->root_motion = root_motion_track == path;
 				track_cache[thash] = track;
 			} else if (track_cache_type == Animation::TYPE_POSITION_3D) {
 				TrackCacheTransform *track_xform = static_cast<TrackCacheTransform *>(track);
@@ -993,10 +994,7 @@ Variant AnimationMixer::_post_process_key_value(const Ref<Animation> &p_anim, in
 	switch (p_anim->track_get_type(p_track)) {
 		case Animation::TYPE_POSITION_3D: {
 			if (p_object_sub_idx >= 0) {
-				Skeleton3D *skel = ObjectDB::get_instance<Skeleton3D>(p_object_id);
-				if (skel) {
-					return Vector3(p_value) * skel->get_motion_scale();
-				}
+				return _post_process_bone_position(p_value, p_object_id);
 			}
 			return p_value;
 		} break;
@@ -1007,6 +1005,16 @@ Variant AnimationMixer::_post_process_key_value(const Ref<Animation> &p_anim, in
 	return p_value;
 }
 
+#ifndef _3D_DISABLED
+Vector3 AnimationMixer::_post_process_bone_position(const Vector3 &p_position, ObjectID p_skeleton_id) const {
+	Skeleton3D *skel = ObjectDB::get_instance<Skeleton3D>(p_skeleton_id);
+	if (skel) {
+		return p_position * skel->get_motion_scale();
+	}
+	return p_position;
+}
+#endif // _3D_DISABLED
+
 Variant AnimationMixer::post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, ObjectID p_object_id, int p_object_sub_idx) {
 	if (is_GDVIRTUAL_CALL_post_process_key_value) {
 		Variant res;
@@ -1131,8 +1139,8 @@ void AnimationMixer::_blend_calc_total_weight() {
 		int track_weights_count = ai.playback_info.track_weights.size();
 		ERR_CONTINUE_EDMSG(!animation_track_num_to_track_cache.has(a), "No animation in cache.");
 		LocalVector<TrackCache *> &track_num_to_track_cache = animation_track_num_to_track_cache[a];
-		thread_local HashSet<Animation::TypeHash, HashHasher> processed_hashes;
-		processed_hashes.clear();
+		// Each track cache is shared by every track with the same type hash, so a per-instance pass stamp on the cache replaces a set of processed hashes.
+		const uint64_t weight_pass = ++blend_weight_pass;
 		const Vector<Animation::Track *> tracks = a->get_tracks();
 		Animation::Track *const *tracks_ptr = tracks.ptr();
 		int count = tracks.size();
@@ -1141,9 +1149,8 @@ void AnimationMixer::_blend_calc_total_weight() {
 			if (!animation_track->enabled) {
 				continue;
 			}
-			Animation::TypeHash thash = animation_track->thash;
 			TrackCache *track = track_num_to_track_cache[i];
-			if (track == nullptr || processed_hashes.has(thash)) {
+			if (track == nullptr || track->weight_pass == weight_pass) {
 				// No path, but avoid error spamming.
 				// Or, there is the case different track type with same path; These can be distinguished by hash. So don't add the weight doubly.
 				continue;
@@ -1152,7 +1159,7 @@ void AnimationMixer::_blend_calc_total_weight() {
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
 			real_t blend = blend_idx < track_weights_count ? track_weights_ptr[blend_idx] * weight : weight;
 			track->total_weight += blend;
-			processed_hashes.insert(thash);
+			track->weight_pass = weight_pass;
 		}
 	}
 }
@@ -1162,6 +1169,9 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
 #endif // TOOLS_ENABLED
+	// Without a script override, post-processing only scales bone positions by the skeleton's motion scale,
+	// so the per-key Variant round trip can be skipped for transform and blend shape tracks.
+	const bool post_process_overridden = is_GDVIRTUAL_CALL_post_process_key_value && GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
 	for (const AnimationInstance &ai : animation_instances) {
 		Ref<Animation> a = ai.animation_data.animation;
 		double time = ai.playback_info.time;
@@ -1206,7 +1216,6 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				blend = blend / track->total_weight;
 			}
 			Animation::TrackType ttype = animation_track->type;
-			track->root_motion = root_motion_track == animation_track->path;
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
 #ifndef _3D_DISABLED
@@ -1346,7 +1355,13 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 						if (err != OK) {
 							continue;
 						}
-						loc = post_process_key_value(a, i, loc, t->object_id, t->bone_idx);
+						if (!post_process_overridden) {
+							if (t->bone_idx >= 0) {
+								loc = _post_process_bone_position(loc, t->object_id);
+							}
+						} else {
+							loc = post_process_key_value(a, i, loc, t->object_id, t->bone_idx);
+						}
 						t->loc += (loc - t->init_loc) * blend;
 					}
 #endif // _3D_DISABLED
@@ -1434,7 +1449,9 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 						if (err != OK) {
 							continue;
 						}
-						rot = post_process_key_value(a, i, rot, t->object_id, t->bone_idx);
+						if (post_process_overridden) {
+							rot = post_process_key_value(a, i, rot, t->object_id, t->bone_idx);
+						}
 						t->rot = (t->rot * Quaternion().slerp(t->init_rot.inverse() * rot, blend)).normalized();
 					}
 #endif // _3D_DISABLED
@@ -1522,7 +1539,9 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 						if (err != OK) {
 							continue;
 						}
-						scale = post_process_key_value(a, i, scale, t->object_id, t->bone_idx);
+						if (post_process_overridden) {
+							scale = post_process_key_value(a, i, scale, t->object_id, t->bone_idx);
+						}
 						t->scale += (scale - t->init_scale) * blend;
 					}
 #endif // _3D_DISABLED
@@ -1539,7 +1558,9 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					if (err != OK) {
 						continue;
 					}
-					value = post_process_key_value(a, i, value, t->object_id, t->shape_index);
+					if (post_process_overridden) {
+						value = post_process_key_value(a, i, value, t->object_id, t->shape_index);
+					}
 					t->value += (value - t->init_value) * blend;
 #endif // _3D_DISABLED
 				} break;
@@ -2061,6 +2082,9 @@ void AnimationMixer::clear_caches() {
 
 void AnimationMixer::set_root_motion_track(const NodePath &p_track) {
 	root_motion_track = p_track;
+	for (KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		K.value->root_motion = root_motion_track == K.value->path;
+	}
 	notify_property_list_changed();
 }
 
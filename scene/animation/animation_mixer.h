@@ -142,10 +142,12 @@ protected:
 	bool cache_valid = false;
 	uint64_t setup_pass = 1;
 	uint64_t process_pass = 1;
+	uint64_t blend_weight_pass = 0;
 
 	struct TrackCache {
 		bool root_motion = false;
 		uint64_t setup_pass = 0;
+		uint64_t weight_pass = 0;
 		Animation::TrackType type = Animation::TrackType::TYPE_ANIMATION;
 		NodePath path;
 		int blend_idx = -1;
@@ -361,6 +363,9 @@ protected:
 	virtual Variant _post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant &p_value, ObjectID p_object_id, int p_object_sub_idx = -1);
 	Variant post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, ObjectID p_object_id, int p_object_sub_idx = -1);
 	GDVIRTUAL5RC(Variant, _post_process_key_value, Ref<Animation>, int, Variant, ObjectID, int);
+#ifndef _3D_DISABLED
+	Vector3 _post_process_bone_position(const Vector3 &p_position, ObjectID p_skeleton_id) const;
+#endif // _3D_DISABLED
 
 	void _blend_init();
 	virtual bool _blend_pre_process(double p_delta, int p_track_count, const AHashMap<NodePath, int> &p_track_map);
@@ -211,7 +211,7 @@ void Button::_notification(int p_what) {
 
 		case NOTIFICATION_TRANSLATION_CHANGED: {
 			xl_text = _get_translated_text(text);
-			_shape();
+			_queue_shape();
 
 			update_minimum_size();
 			queue_accessibility_update();
@@ -219,7 +219,7 @@ void Button::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_THEME_CHANGED: {
-			_shape();
+			_queue_shape();
 
 			update_minimum_size();
 			queue_redraw();
@@ -227,7 +227,7 @@ void Button::_notification(int p_what) {
 
 		case NOTIFICATION_RESIZED: {
 			if (autowrap_mode != TextServer::AUTOWRAP_OFF) {
-				_shape();
+				_queue_shape();
 
 				update_minimum_size();
 				queue_redraw();
@@ -235,6 +235,8 @@ void Button::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_DRAW: {
+			_ensure_shaped();
+
 			// Reshape and update size min. if text is invalidated by an external source (e.g., oversampling).
 			if (text_buf.is_valid() && !TS->shaped_text_is_ready(text_buf->get_rid())) {
 				_shape();
@@ -517,6 +519,7 @@ Size2 Button::get_minimum_size_for_text_and_icon(const String &p_text, Ref<Textu
 
 	Ref<TextParagraph> paragraph;
 	if (p_text.is_empty()) {
+		_ensure_shaped();
 		paragraph = text_buf;
 	} else {
 		paragraph.instantiate();
@@ -559,9 +562,20 @@ Size2 Button::get_minimum_size_for_text_and_icon(const String &p_text, Ref<Textu
 	return (theme_cache.align_to_largest_stylebox ? _get_largest_stylebox_size() : _get_current_stylebox()->get_minimum_size()) + minsize;
 }
 
+void Button::_queue_shape() {
+	text_shape_dirty = true;
+}
+
+void Button::_ensure_shaped() const {
+	if (text_shape_dirty) {
+		_shape();
+	}
+}
+
 void Button::_shape(Ref<TextParagraph> p_paragraph, String p_text) const {
 	if (p_paragraph.is_null()) {
 		p_paragraph = text_buf;
+		text_shape_dirty = false;
 	}
 
 	if (p_text.is_empty()) {
@@ -608,7 +622,7 @@ void Button::set_text_overrun_behavior(TextServer::OverrunBehavior p_behavior) {
 	if (overrun_behavior != p_behavior) {
 		bool need_update_cache = overrun_behavior == TextServer::OVERRUN_NO_TRIMMING || p_behavior == TextServer::OVERRUN_NO_TRIMMING;
 		overrun_behavior = p_behavior;
-		_shape();
+		_queue_shape();
 
 		if (need_update_cache) {
 			_queue_update_size_cache();
@@ -629,7 +643,7 @@ void Button::set_text(const String &p_text) {
 	}
 	text = p_text;
 	xl_text = translated_text;
-	_shape();
+	_queue_shape();
 
 	queue_accessibility_update();
 	queue_redraw();
@@ -643,7 +657,7 @@ String Button::get_text() const {
 void Button::set_autowrap_mode(TextServer::AutowrapMode p_mode) {
 	if (autowrap_mode != p_mode) {
 		autowrap_mode = p_mode;
-		_shape();
+		_queue_shape();
 		queue_redraw();
 		update_minimum_size();
 	}
@@ -656,7 +670,7 @@ TextServer::AutowrapMode Button::get_autowrap_mode() const {
 void Button::set_autowrap_trim_flags(BitField<TextServer::LineBreakFlag> p_flags) {
 	if (autowrap_flags_trim != (p_flags & TextServer::BREAK_TRIM_MASK)) {
 		autowrap_flags_trim = p_flags & TextServer::BREAK_TRIM_MASK;
-		_shape();
+		_queue_shape();
 		queue_redraw();
 		update_minimum_size();
 	}
@@ -670,7 +684,7 @@ void Button::set_text_direction(Control::TextDirection p_text_direction) {
 	ERR_FAIL_COND((int)p_text_direction < -1 || (int)p_text_direction > 3);
 	if (text_direction != p_text_direction) {
 		text_direction = p_text_direction;
-		_shape();
+		_queue_shape();
 		queue_accessibility_update();
 		queue_redraw();
 	}
@@ -683,7 +697,7 @@ Control::TextDirection Button::get_text_direction() const {
 void Button::set_language(const String &p_language) {
 	if (language != p_language) {
 		language = p_language;
-		_shape();
+		_queue_shape();
 		queue_accessibility_update();
 		queue_redraw();
 	}
@@ -41,6 +41,7 @@ private:
 	String text;
 	String xl_text;
 	Ref<TextParagraph> text_buf;
+	mutable bool text_shape_dirty = false;
 
 	String language;
 	TextDirection text_direction = TEXT_DIRECTION_AUTO;
@@ -103,6 +104,8 @@ private:
 		int line_spacing = 0;
 	} theme_cache;
 
+	void _queue_shape();
+	void _ensure_shaped() const;
 	void _shape(Ref<TextParagraph> p_paragraph = Ref<TextParagraph>(), String p_text = "") const;
 	void _texture_changed();
 
@@ -30,6 +30,15 @@
 
 #include "container.h"
 
+#include "core/config/engine.h"
+#include "core/os/os.h"
+
+SelfList<Container>::List Container::sort_queue;
+bool Container::sort_queue_flush_queued = false;
+uint64_t Container::layout_stats_frame = 0;
+Container::LayoutStats Container::layout_stats_current;
+Container::LayoutStats Container::layout_stats_previous;
+
 void Container::_child_minsize_changed() {
 	update_minimum_size();
 	queue_sort();
@@ -79,6 +88,7 @@ void Container::remove_child_notify(Node *p_child) {
 }
 
 void Container::_sort_children() {
+	sort_queue_item.remove_from_list();
 	if (!is_inside_tree()) {
 		pending_sort = false;
 		return;
@@ -135,9 +145,92 @@ void Container::queue_sort() {
 	if (pending_sort) {
 		return;
 	}
-
-	callable_mp(this, &Container::_sort_children).call_deferred();
 	pending_sort = true;
+
+	if (!Thread::is_main_thread()) {
+		callable_mp(this, &Container::_sort_children).call_deferred();
+		return;
+	}
+
+	sort_queue.add_last(&sort_queue_item);
+	if (!sort_queue_flush_queued) {
+		sort_queue_flush_queued = true;
+		callable_mp_static(&Container::_flush_sort_queue).call_deferred();
+	}
+}
+
+void Container::_flush_sort_queue() {
+	uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+	uint64_t sorts = 0;
+	LocalVector<Container *> containers;
+	LocalVector<ObjectID> container_ids;
+
+	// Sorting may resize children, which can change minimum sizes and queue more sorts further down.
+	// Those are handled by the next pass, so the amount of passes is bounded by the depth of nested containers.
+	while (sort_queue.first()) {
+		// Measure: settle pending minimum sizes first, a container sorted before its children report their new size would have to sort again.
+		Control::_flush_minimum_size_updates();
+
+		// Arrange: parents first, so children are sorted with their final size.
+		containers.clear();
+		while (sort_queue.first()) {
+			Container *container = sort_queue.first()->self();
+			container->sort_queue_item.remove_from_list();
+			if (container->is_inside_tree()) {
+				containers.push_back(container);
+			} else {
+				container->pending_sort = false;
+			}
+		}
+		containers.sort_custom<Node::Comparator>();
+
+		// Sorting runs user code which may free containers, so keep IDs rather than pointers.
+		container_ids.clear();
+		for (Container *container : containers) {
+			container_ids.push_back(container->get_instance_id());
+		}
+
+		for (const ObjectID &id : container_ids) {
+			Container *container = ObjectDB::get_instance<Container>(id);
+			// Skip containers that were freed or queued again during this pass, the latter are sorted by the next one.
+			if (container && container->pending_sort && !container->sort_queue_item.in_list()) {
+				container->_sort_children();
+				sorts++;
+			}
+		}
+	}
+
+	sort_queue_flush_queued = false;
+	_record_layout_stats(sorts, OS::get_singleton()->get_ticks_usec() - begin_usec);
+}
+
+void Container::_record_layout_stats(uint64_t p_sorts, uint64_t p_usec) {
+	uint64_t frame = Engine::get_singleton()->get_process_frames();
+	if (frame != layout_stats_frame) {
+		layout_stats_previous = frame == layout_stats_frame + 1 ? layout_stats_current : LayoutStats();
+		layout_stats_current = LayoutStats();
+		layout_stats_frame = frame;
+	}
+	layout_stats_current.sorts += p_sorts;
+	layout_stats_current.usec += p_usec;
+}
+
+Container::LayoutStats Container::_get_last_frame_layout_stats() {
+	uint64_t frame = Engine::get_singleton()->get_process_frames();
+	if (frame == layout_stats_frame) {
+		return layout_stats_previous;
+	} else if (frame == layout_stats_frame + 1) {
+		return layout_stats_current;
+	}
+	return LayoutStats();
+}
+
+uint64_t Container::get_last_frame_sort_count() {
+	return _get_last_frame_layout_stats().sorts;
+}
+
+double Container::get_last_frame_sort_time() {
+	return _get_last_frame_layout_stats().usec / 1000000.0;
 }
 
 Control *Container::as_sortable_control(Node *p_node, SortableVisibilityMode p_visibility_mode) const {
@@ -228,7 +321,8 @@ void Container::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("sort_children"));
 }
 
-Container::Container() {
+Container::Container() :
+		sort_queue_item(this) {
 	// All containers should let mouse events pass by default.
 	set_mouse_filter(MOUSE_FILTER_PASS);
 }
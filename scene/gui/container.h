@@ -39,6 +39,25 @@ class Container : public Control {
 	void _sort_children();
 	void _child_minsize_changed();
 
+	// Sorts queued from the main thread are batched and run top-down, once pending minimum sizes are known.
+	// This way a container resized by its parent's sort is only sorted once, with its final size.
+	static SelfList<Container>::List sort_queue;
+	static bool sort_queue_flush_queued;
+	SelfList<Container> sort_queue_item;
+
+	static void _flush_sort_queue();
+
+	struct LayoutStats {
+		uint64_t sorts = 0;
+		uint64_t usec = 0;
+	};
+	static uint64_t layout_stats_frame;
+	static LayoutStats layout_stats_current;
+	static LayoutStats layout_stats_previous;
+
+	static void _record_layout_stats(uint64_t p_sorts, uint64_t p_usec);
+	static LayoutStats _get_last_frame_layout_stats();
+
 protected:
 	enum class SortableVisibilityMode {
 		VISIBLE,
@@ -72,5 +91,8 @@ public:
 
 	PackedStringArray get_configuration_warnings() const override;
 
+	static uint64_t get_last_frame_sort_count();
+	static double get_last_frame_sort_time();
+
 	Container();
 };
@@ -1625,6 +1625,7 @@ Vector2 Control::get_pivot_offset() const {
 /// Sizes.
 
 void Control::_update_minimum_size() {
+	minimum_size_update_item.remove_from_list();
 	if (!is_inside_tree()) {
 		data.updating_last_minimum_size = false;
 		return;
@@ -1672,9 +1673,26 @@ void Control::update_minimum_size() {
 	}
 	data.updating_last_minimum_size = true;
 
+	// The update list is not synchronized, so other threads marked safe for nodes only rely on the deferred call.
+	if (Thread::is_main_thread()) {
+		minimum_size_update_list.add_last(&minimum_size_update_item);
+	}
 	callable_mp(this, &Control::_update_minimum_size).call_deferred();
 }
 
+void Control::_flush_minimum_size_updates() {
+	// Run pending updates now instead of waiting for their deferred call, which then does nothing.
+	// Updates queued while flushing (e.g. by a parent whose minimum size changed as a result) are processed too.
+	while (minimum_size_update_list.first()) {
+		Control *control = minimum_size_update_list.first()->self();
+		if (control->data.updating_last_minimum_size) {
+			control->_update_minimum_size();
+		} else {
+			control->minimum_size_update_item.remove_from_list();
+		}
+	}
+}
+
 void Control::set_block_minimum_size_adjust(bool p_block) {
 	ERR_MAIN_THREAD_GUARD;
 	data.block_minimum_size_adjust = p_block;
@@ -4399,7 +4417,10 @@ void Control::_bind_methods() {
 	GDVIRTUAL_BIND(_gui_input, "event");
 }
 
-Control::Control() {
+SelfList<Control>::List Control::minimum_size_update_list;
+
+Control::Control() :
+		minimum_size_update_item(this) {
 	data.theme_owner = memnew(ThemeOwner(this));
 
 	set_physics_interpolation_mode(Node::PHYSICS_INTERPOLATION_MODE_OFF);
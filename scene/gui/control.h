@@ -326,6 +326,10 @@ private:
 	void _set_anchors_layout_preset(int p_preset);
 	int _get_anchors_layout_preset() const;
 
+	// Controls with a deferred minimum size update, so containers can settle sizes before sorting.
+	static SelfList<Control>::List minimum_size_update_list;
+	SelfList<Control> minimum_size_update_item;
+
 	void _update_minimum_size_cache() const;
 	void _update_minimum_size();
 	void _size_changed();
@@ -365,6 +369,8 @@ private:
 	static int root_layout_direction;
 
 protected:
+	static void _flush_minimum_size_updates();
+
 	// Dynamic properties.
 
 	bool _set(const StringName &p_name, const Variant &p_value);
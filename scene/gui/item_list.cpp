@@ -34,8 +34,18 @@
 #include "core/os/os.h"
 #include "scene/theme/theme_db.h"
 
+void ItemList::_queue_shape_text(int p_idx) {
+	// Shaping is deferred until the item is measured or drawn, so bulk edits
+	// and theme or translation changes don't reshape the same item repeatedly.
+	items.write[p_idx].text_shape_dirty = true;
+}
+
 void ItemList::_shape_text(int p_idx) {
 	Item &item = items.write[p_idx];
+	if (!item.text_shape_dirty) {
+		return;
+	}
+	item.text_shape_dirty = false;
 
 	item.text_buf->clear();
 	if (item.text_direction == Control::TEXT_DIRECTION_INHERITED) {
@@ -62,7 +72,7 @@ int ItemList::add_item(const String &p_item, const Ref<Texture2D> &p_texture, bo
 	int item_id = items.size() - 1;
 
 	items.write[item_id].xl_text = _atr(item_id, p_item);
-	_shape_text(item_id);
+	_queue_shape_text(item_id);
 
 	queue_accessibility_update();
 	queue_redraw();
@@ -97,7 +107,7 @@ void ItemList::set_item_text(int p_idx, const String &p_text) {
 
 	items.write[p_idx].text = p_text;
 	items.write[p_idx].xl_text = _atr(p_idx, p_text);
-	_shape_text(p_idx);
+	_queue_shape_text(p_idx);
 	queue_accessibility_update();
 	queue_redraw();
 	shape_changed = true;
@@ -116,7 +126,7 @@ void ItemList::set_item_text_direction(int p_idx, Control::TextDirection p_text_
 	ERR_FAIL_COND((int)p_text_direction < -1 || (int)p_text_direction > 3);
 	if (items[p_idx].text_direction != p_text_direction) {
 		items.write[p_idx].text_direction = p_text_direction;
-		_shape_text(p_idx);
+		_queue_shape_text(p_idx);
 		queue_accessibility_update();
 		queue_redraw();
 	}
@@ -134,7 +144,7 @@ void ItemList::set_item_language(int p_idx, const String &p_language) {
 	ERR_FAIL_INDEX(p_idx, items.size());
 	if (items[p_idx].language != p_language) {
 		items.write[p_idx].language = p_language;
-		_shape_text(p_idx);
+		_queue_shape_text(p_idx);
 		queue_accessibility_update();
 		queue_redraw();
 	}
@@ -153,7 +163,7 @@ void ItemList::set_item_auto_translate_mode(int p_idx, AutoTranslateMode p_mode)
 	if (items[p_idx].auto_translate_mode != p_mode) {
 		items.write[p_idx].auto_translate_mode = p_mode;
 		items.write[p_idx].xl_text = _atr(p_idx, items[p_idx].text);
-		_shape_text(p_idx);
+		_queue_shape_text(p_idx);
 		queue_accessibility_update();
 		queue_redraw();
 	}
@@ -1337,7 +1347,7 @@ void ItemList::_notification(int p_what) {
 		case NOTIFICATION_LAYOUT_DIRECTION_CHANGED:
 		case NOTIFICATION_THEME_CHANGED: {
 			for (int i = 0; i < items.size(); i++) {
-				_shape_text(i);
+				_queue_shape_text(i);
 			}
 			shape_changed = true;
 			queue_accessibility_update();
@@ -1346,7 +1356,7 @@ void ItemList::_notification(int p_what) {
 		case NOTIFICATION_TRANSLATION_CHANGED: {
 			for (int i = 0; i < items.size(); i++) {
 				items.write[i].xl_text = _atr(i, items[i].text);
-				_shape_text(i);
+				_queue_shape_text(i);
 			}
 			shape_changed = true;
 			queue_accessibility_update();
@@ -1448,29 +1458,7 @@ void ItemList::_notification(int p_what) {
 				}
 			}
 
-			// Do a binary search to find the first item whose rect reaches below clip.position.y.
-			int first_item_visible;
-			{
-				int lo = 0;
-				int hi = items.size();
-				while (lo < hi) {
-					const int mid = (lo + hi) / 2;
-					const Rect2 &rcache = items[mid].rect_cache;
-					if (rcache.position.y + rcache.size.y < clip.position.y) {
-						lo = mid + 1;
-					} else {
-						hi = mid;
-					}
-				}
-
-				// We might end up with an item in columns 2, 3, etc, but we need the one from the first column.
-				// We can also end up in a state where lo reached hi, and so no items can be rendered; we skip that.
-				while (lo < hi && lo > 0 && items[lo].column > 0) {
-					lo -= 1;
-				}
-
-				first_item_visible = lo;
-			}
+			const int first_item_visible = _get_first_item_in_rows_from(clip.position.y);
 
 			Rect2 cursor_rcache; // Place to save the position of the cursor and draw it after everything else.
 
@@ -1594,6 +1582,7 @@ void ItemList::_notification(int p_what) {
 				}
 
 				if (!items[i].text.is_empty()) {
+					_shape_text(i);
 					Color txt_modulate;
 					if (items[i].selected && hovered == i) {
 						txt_modulate = theme_cache.font_hovered_selected_color;
@@ -1734,6 +1723,7 @@ void ItemList::force_update_list_size() {
 		}
 
 		if (!items[i].text.is_empty()) {
+			_shape_text(i);
 			int max_width = -1;
 			if (fixed_column_width) {
 				max_width = fixed_column_width;
@@ -1941,6 +1931,29 @@ String ItemList::_atr(int p_idx, const String &p_text) const {
 	ERR_FAIL_V_MSG(atr(p_text), "Unexpected auto translate mode: " + itos(items[p_idx].auto_translate_mode));
 }
 
+int ItemList::_get_first_item_in_rows_from(real_t p_y) const {
+	// Rows are laid out top to bottom, so do a binary search to find the first item whose rect reaches below p_y.
+	int lo = 0;
+	int hi = items.size();
+	while (lo < hi) {
+		const int mid = (lo + hi) / 2;
+		const Rect2 &rcache = items[mid].rect_cache;
+		if (rcache.position.y + rcache.size.y < p_y) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	// We might end up with an item in columns 2, 3, etc, but we need the one from the first column.
+	// We can also end up in a state where lo reached hi, and so no items are found; callers skip that.
+	while (lo < hi && lo > 0 && items[lo].column > 0) {
+		lo -= 1;
+	}
+
+	return lo;
+}
+
 int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 	Vector2 pos = p_pos;
 	pos -= theme_cache.panel_style->get_offset();
@@ -1954,9 +1967,16 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 	int closest = -1;
 	int closest_dist = 0x7FFFFFFF;
 
-	for (int i = 0; i < items.size(); i++) {
+	// An exact hit can only come from the rows crossing pos.y, so skip straight to them.
+	const int from = p_exact ? _get_first_item_in_rows_from(pos.y) : 0;
+
+	for (int i = from; i < items.size(); i++) {
 		Rect2 rc = items[i].rect_cache;
 
+		if (p_exact && rc.position.y > pos.y) {
+			break;
+		}
+
 		if (i % current_columns == current_columns - 1) { // Make sure you can still select the last item when clicking past the column.
 			if (is_layout_rtl()) {
 				rc.size.width = get_size().width - scroll_bar_h->get_value() + rc.position.x;
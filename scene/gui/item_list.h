@@ -63,6 +63,7 @@ private:
 		String text;
 		String xl_text;
 		Ref<TextParagraph> text_buf;
+		bool text_shape_dirty = false;
 		String language;
 		TextDirection text_direction = TEXT_DIRECTION_AUTO;
 		AutoTranslateMode auto_translate_mode = AUTO_TRANSLATE_MODE_INHERIT;
@@ -144,7 +145,9 @@ private:
 	bool do_autoscroll_to_bottom = false;
 
 	void _scroll_changed(double);
+	void _queue_shape_text(int p_idx);
 	void _shape_text(int p_idx);
+	int _get_first_item_in_rows_from(real_t p_y) const;
 	void _mouse_exited();
 	void _shift_range_select(int p_from, int p_to);
 
@@ -390,14 +390,8 @@ void TextEdit::Text::invalidate_cache(int p_line, bool p_text_changed) {
 }
 
 void TextEdit::Text::invalidate_all_lines() {
+	// invalidate_cache() already reapplies the tab stops, so a tab size change needs no separate pass.
 	for (int i = 0; i < text.size(); i++) {
-		if (tab_size_dirty) {
-			if (tab_size > 0) {
-				Vector<float> tabs;
-				tabs.push_back(font->get_char_size(' ', font_size).width * tab_size);
-				text[i].data_buf->tab_align(tabs);
-			}
-		}
 		invalidate_cache(i, false);
 	}
 	tab_size_dirty = false;
@@ -508,11 +502,12 @@ void TextEdit::Text::insert(int p_at, const Vector<String> &p_text, const Vector
 	int new_line_count = p_text.size() - 1;
 	if (new_line_count > 0) {
 		text.resize(text.size() + new_line_count);
-		for (int i = (text.size() - 1); i > p_at; i--) {
-			if ((i - new_line_count) <= 0) {
-				break;
-			}
-			text.write[i] = text[i - new_line_count];
+
+		// Move the lines after the insertion point instead of copying them, so
+		// inserting into large documents doesn't touch every line's refcounts.
+		Line *lines = text.ptrw();
+		for (int i = text.size() - 1; i > p_at + new_line_count; i--) {
+			lines[i] = std::move(lines[i - new_line_count]);
 		}
 	}
 
@@ -525,7 +520,7 @@ void TextEdit::Text::insert(int p_at, const Vector<String> &p_text, const Vector
 		line.gutters.resize(gutter_count);
 		line.data = p_text[i];
 		line.bidi_override = p_bidi_override[i];
-		text.write[p_at + i] = line;
+		text.write[p_at + i] = std::move(line);
 		invalidate_cache(p_at + i, true);
 	}
 }
@@ -551,8 +546,9 @@ void TextEdit::Text::remove_range(int p_from_line, int p_to_line) {
 	}
 
 	int diff = p_to_line - p_from_line;
+	Line *lines = text.ptrw();
 	for (int i = p_to_line + 1; i < text.size(); i++) {
-		text.write[i - diff] = text[i];
+		lines[i - diff] = std::move(lines[i]);
 	}
 	text.resize(text.size() - diff);
 
@@ -9154,8 +9150,9 @@ void TextEdit::_base_insert_text(int p_line, int p_char, const String &p_text, i
 	bool shift_first_line = p_char == 0 && substrings.size() == 2 && text_to_insert == "\n";
 
 	/* STEP 2: Add spaces if the char is greater than the end of the line. */
-	while (p_char > text[p_line].length()) {
-		text.set(p_line, text[p_line] + String::chr(' '), structured_text_parser(st_parser, st_args, text[p_line] + String::chr(' ')));
+	if (p_char > text[p_line].length()) {
+		const String padded_line = text[p_line] + String(" ").repeat(p_char - text[p_line].length());
+		text.set(p_line, padded_line, structured_text_parser(st_parser, st_args, padded_line));
 	}
 
 	/* STEP 3: Separate dest string in pre and post text. */
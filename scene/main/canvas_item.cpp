@@ -360,7 +360,7 @@ void CanvasItem::_notification(int p_what) {
 			_update_texture_repeat_changed(false);
 
 			if (!block_transform_notify && !xform_change.in_list()) {
-				get_tree()->xform_change_list.add(&xform_change);
+				get_tree()->_add_xform_change(&xform_change);
 			}
 
 			if (get_viewport()) {
@@ -385,7 +385,7 @@ void CanvasItem::_notification(int p_what) {
 			ERR_MAIN_THREAD_GUARD;
 
 			if (xform_change.in_list()) {
-				get_tree()->xform_change_list.remove(&xform_change);
+				get_tree()->_remove_xform_change(&xform_change);
 			}
 			_exit_canvas();
 			if (C) {
@@ -1027,7 +1027,7 @@ void CanvasItem::draw_char_outline(const Ref<Font> &p_font, const Point2 &p_pos,
 
 void CanvasItem::_notify_transform_deferred() {
 	if (is_inside_tree() && notify_transform && !xform_change.in_list()) {
-		get_tree()->xform_change_list.add(&xform_change);
+		get_tree()->_add_xform_change(&xform_change);
 	}
 }
 
@@ -1048,7 +1048,7 @@ void CanvasItem::_notify_transform(CanvasItem *p_node) {
 		if (!p_node->block_transform_notify) {
 			if (p_node->is_inside_tree()) {
 				if (is_accessible_from_caller_thread()) {
-					get_tree()->xform_change_list.add(&p_node->xform_change);
+					get_tree()->_add_xform_change(&p_node->xform_change);
 				} else {
 					// Should be rare, but still needs to be handled.
 					callable_mp(p_node, &CanvasItem::_notify_transform_deferred).call_deferred();
@@ -1250,7 +1250,7 @@ void CanvasItem::force_update_transform() {
 		return;
 	}
 
-	get_tree()->xform_change_list.remove(&xform_change);
+	get_tree()->_remove_xform_change(&xform_change);
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
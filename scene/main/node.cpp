@@ -47,6 +47,7 @@
 int Node::orphan_node_count = 0;
 
 thread_local Node *Node::current_process_thread_group = nullptr;
+thread_local Node *Node::current_group_call_node = nullptr;
 
 void Node::_notification(int p_notification) {
 	switch (p_notification) {
@@ -1412,6 +1413,10 @@ StringName Node::get_name() const {
 
 void Node::_set_name_nocheck(const StringName &p_name) {
 	data.name = p_name;
+	_invalidate_resolved_paths();
+	if (data.parent) {
+		data.parent->_invalidate_resolved_paths();
+	}
 }
 
 void Node::set_name(const StringName &p_name) {
@@ -1443,6 +1448,11 @@ void Node::set_name(const StringName &p_name) {
 		_acquire_unique_name_in_owner();
 	}
 
+	_invalidate_resolved_paths();
+	if (data.parent) {
+		data.parent->_invalidate_resolved_paths();
+	}
+
 	propagate_notification(NOTIFICATION_PATH_RENAMED);
 
 	if (is_inside_tree()) {
@@ -1641,6 +1651,8 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 
 	p_child->data.name = p_name;
 	data.children.insert(p_name, p_child);
+	_invalidate_resolved_paths();
+	p_child->_invalidate_resolved_paths();
 
 	p_child->data.internal_mode = p_internal_mode;
 	switch (p_internal_mode) {
@@ -1742,6 +1754,8 @@ void Node::remove_child(Node *p_child) {
 
 	p_child->data.parent = nullptr;
 	p_child->data.index = -1;
+	_invalidate_resolved_paths();
+	p_child->_invalidate_resolved_paths();
 
 	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
 	emit_signal(SNAME("child_order_changed"));
@@ -1841,15 +1855,61 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	if (!data.tree) {
+		// Nodes outside the tree can be accessed from any thread, so don't touch the cache.
+		return _resolve_node_path(p_path);
+	}
+
+	if (data.resolved_path_cache) {
+		for (int i = 0; i < RESOLVED_PATH_CACHE_SIZE; i++) {
+			const ResolvedPath &resolved = data.resolved_path_cache[i];
+			if (resolved.chain.is_empty() || resolved.path != p_path) {
+				continue;
+			}
+			bool valid = true;
+			for (const ResolvedPath::Link &link : resolved.chain) {
+				if (link.node->data.path_generation != link.generation) {
+					valid = false;
+					break;
+				}
+			}
+			if (valid) {
+				return resolved.node;
+			}
+		}
+	} else {
+		data.resolved_path_cache = memnew_arr(ResolvedPath, RESOLVED_PATH_CACHE_SIZE);
+	}
+
+	ResolvedPath &resolved = data.resolved_path_cache[data.resolved_path_cache_next];
+	resolved.chain.clear();
+	resolved.node = _resolve_node_path(p_path, &resolved.chain);
+	resolved.path = p_path;
+	data.resolved_path_cache_next = (data.resolved_path_cache_next + 1) % RESOLVED_PATH_CACHE_SIZE;
+
+	return resolved.node;
+}
+
+Node *Node::_resolve_node_path(const NodePath &p_path, LocalVector<ResolvedPath::Link> *r_chain) const {
+	// Records every node whose state the resolution depends on, see get_node_or_null().
+	auto record_link = [r_chain](const Node *p_node) {
+		if (r_chain) {
+			r_chain->push_back({ const_cast<Node *>(p_node), p_node->data.path_generation });
+		}
+	};
+
 	Node *current = nullptr;
 	Node *root = nullptr;
 
 	if (!p_path.is_absolute()) {
 		current = const_cast<Node *>(this); //start from this
+		record_link(current);
 	} else {
 		root = const_cast<Node *>(this);
+		record_link(root);
 		while (root->data.parent) {
 			root = root->data.parent; //start from root
+			record_link(root);
 		}
 	}
 
@@ -1874,6 +1934,7 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 		} else if (name.is_node_unique_name()) {
 			Node **unique = current->data.owned_unique_nodes.getptr(name);
 			if (!unique && current->data.owner) {
+				record_link(current->data.owner);
 				unique = current->data.owner->data.owned_unique_nodes.getptr(name);
 			}
 			if (!unique) {
@@ -1889,6 +1950,10 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 				return nullptr;
 			}
 		}
+		if (next && next != current && i + 1 < p_path.get_name_count()) {
+			// The last node is not consulted, so changes to it don't invalidate the path.
+			record_link(next);
+		}
 		current = next;
 	}
 
@@ -2160,6 +2225,7 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 	data.owner = p_owner;
 	data.owner->data.owned.push_back(this);
 	data.OW = data.owner->data.owned.back();
+	_invalidate_resolved_paths();
 
 	owner_changed_notify();
 }
@@ -2172,6 +2238,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	data.owner->_invalidate_resolved_paths();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -2186,6 +2253,7 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	data.owner->_invalidate_resolved_paths();
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -2249,6 +2317,7 @@ void Node::_clean_up_owner() {
 	data.owner->data.owned.erase(data.OW);
 	data.owner = nullptr;
 	data.OW = nullptr;
+	_invalidate_resolved_paths();
 }
 
 Node *Node::find_common_parent_with(const Node *p_node) const {
@@ -4081,6 +4150,10 @@ Node::Node() {
 }
 
 Node::~Node() {
+	if (data.resolved_path_cache) {
+		memdelete_arr(data.resolved_path_cache);
+	}
+
 	data.grouped.clear();
 	data.owned.clear();
 	data.children.clear();
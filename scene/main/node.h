@@ -133,6 +133,25 @@ public:
 	void _update_process(bool p_enable, bool p_for_children);
 
 private:
+	// Recently resolved paths. An entry stays valid as long as none of the nodes consulted while resolving it
+	// had its children, parent, name, owner or unique names changed since, which bumps their path_generation.
+	struct ResolvedPath {
+		struct Link {
+			Node *node = nullptr;
+			uint32_t generation = 0;
+		};
+
+		NodePath path;
+		Node *node = nullptr;
+		// In resolution order, so each node is only reached through links that are still valid.
+		LocalVector<Link> chain;
+	};
+
+	static constexpr int RESOLVED_PATH_CACHE_SIZE = 4;
+
+	_FORCE_INLINE_ void _invalidate_resolved_paths() { data.path_generation++; }
+	Node *_resolve_node_path(const NodePath &p_path, LocalVector<ResolvedPath::Link> *r_chain = nullptr) const;
+
 	struct GroupData {
 		bool persistent = false;
 		SceneTree::Group *group = nullptr;
@@ -260,6 +279,10 @@ private:
 
 		mutable NodePath *path_cache = nullptr;
 
+		mutable ResolvedPath *resolved_path_cache = nullptr; // Allocated on the first get_node() call inside the tree.
+		mutable uint8_t resolved_path_cache_next = 0;
+		uint32_t path_generation = 0;
+
 	} data;
 
 	Ref<MultiplayerAPI> multiplayer;
@@ -327,6 +350,7 @@ private:
 	void _add_tree_to_process_thread_group(Node *p_owner);
 
 	static thread_local Node *current_process_thread_group;
+	static thread_local Node *current_group_call_node; // Node called from a worker thread by SceneTree::call_group_flags().
 
 	Variant _call_deferred_thread_group_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	Variant _call_thread_safe_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
@@ -644,9 +668,10 @@ public:
 	_FORCE_INLINE_ bool is_accessible_from_caller_thread() const {
 		if (current_process_thread_group == nullptr) {
 			// No thread processing.
-			// Only accessible if node is outside the scene tree
-			// or access will happen from a node-safe thread.
-			return !data.tree || is_current_thread_safe_for_nodes();
+			// Only accessible if node is outside the scene tree,
+			// access will happen from a node-safe thread,
+			// or this node is the target of a parallel group call.
+			return !data.tree || is_current_thread_safe_for_nodes() || current_group_call_node == this;
 		} else {
 			// Thread processing.
 			return current_process_thread_group == data.process_thread_group_owner;
@@ -658,7 +683,7 @@ public:
 			// No thread processing.
 			// Only accessible if node is outside the scene tree
 			// or access will happen from a node-safe thread.
-			return is_current_thread_safe_for_nodes() || unlikely(!data.tree);
+			return is_current_thread_safe_for_nodes() || unlikely(!data.tree) || current_group_call_node == this;
 		} else {
 			// Thread processing.
 			return true;
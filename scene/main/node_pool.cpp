@@ -0,0 +1,250 @@
+/**************************************************************************/
+/*  node_pool.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "node_pool.h"
+
+#include "scene/main/scene_tree.h"
+
+Node *NodePool::_instantiate() {
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "NodePool has no scene to instantiate.");
+
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+
+	if (!scene_defaults_valid) {
+		_take_scene_defaults(node);
+	}
+
+	if (pooled_nodes.size() >= pooled_nodes_prune_size) {
+		_prune_pooled_nodes();
+	}
+	pooled_nodes.insert(node->get_instance_id(), false);
+
+	return node;
+}
+
+void NodePool::_take_scene_defaults(Node *p_root) {
+	Ref<SceneState> state = scene->get_state();
+	ERR_FAIL_COND(state.is_null());
+
+	scene_defaults.clear();
+	for (int i = 0; i < state->get_node_count(); i++) {
+		NodePath path = state->get_node_path(i);
+		Node *node = p_root->get_node_or_null(path);
+		if (!node) {
+			continue;
+		}
+
+		NodeState node_state;
+		node_state.path = path;
+
+		List<PropertyInfo> properties;
+		node->get_property_list(&properties);
+		for (const PropertyInfo &E : properties) {
+			if (!(E.usage & PROPERTY_USAGE_STORAGE)) {
+				continue;
+			}
+
+			Variant value = node->get(E.name);
+			if (value.get_type() == Variant::OBJECT) {
+				// Nodes and scene-local resources belong to the first instance, they can't be shared.
+				Object *obj = value;
+				Resource *res = Object::cast_to<Resource>(obj);
+				if (Object::cast_to<Node>(obj) || (res && res->is_local_to_scene())) {
+					continue;
+				}
+			}
+
+			node_state.properties.push_back({ E.name, value.duplicate(true) });
+		}
+
+		scene_defaults.push_back(node_state);
+	}
+
+	scene_defaults_valid = true;
+}
+
+void NodePool::_reset_to_scene_defaults(Node *p_root) const {
+	for (const NodeState &node_state : scene_defaults) {
+		Node *node = p_root->get_node_or_null(node_state.path);
+		if (!node) {
+			continue;
+		}
+
+		// Only touch what was changed since the node was instantiated.
+		for (const PropertyState &E : node_state.properties) {
+			Variant current = node->get(E.name);
+			if (current.get_type() != E.value.get_type() || current != E.value) {
+				node->set(E.name, E.value.duplicate(true));
+			}
+		}
+	}
+}
+
+void NodePool::_free_node(Node *p_node) {
+	pooled_nodes.erase(p_node->get_instance_id());
+	if (SceneTree::get_singleton()) {
+		p_node->queue_free();
+	} else {
+		memdelete(p_node);
+	}
+}
+
+void NodePool::_prune_pooled_nodes() {
+	// Nodes freed by the user instead of being released are forgotten here.
+	LocalVector<ObjectID> stale;
+	for (const KeyValue<ObjectID, bool> &E : pooled_nodes) {
+		if (!ObjectDB::get_instance(E.key)) {
+			stale.push_back(E.key);
+		}
+	}
+	for (const ObjectID &id : stale) {
+		pooled_nodes.erase(id);
+	}
+	pooled_nodes_prune_size = MAX(256u, pooled_nodes.size() * 2);
+}
+
+void NodePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+	clear();
+	pooled_nodes.clear();
+	scene_defaults.clear();
+	scene_defaults_valid = false;
+	scene = p_scene;
+}
+
+Ref<PackedScene> NodePool::get_scene() const {
+	return scene;
+}
+
+void NodePool::set_capacity(int p_capacity) {
+	ERR_FAIL_COND_MSG(p_capacity < 0, "NodePool capacity can't be negative.");
+	capacity = p_capacity;
+
+	while ((int)available.size() > capacity) {
+		Node *node = ObjectDB::get_instance<Node>(available[available.size() - 1]);
+		available.resize(available.size() - 1);
+		if (node) {
+			_free_node(node);
+		}
+	}
+}
+
+int NodePool::get_capacity() const {
+	return capacity;
+}
+
+void NodePool::prewarm(int p_count) {
+	ERR_FAIL_COND_MSG(p_count < 0, "The number of nodes to prewarm can't be negative.");
+	const int count = MIN(p_count, capacity);
+	while ((int)available.size() < count) {
+		Node *node = _instantiate();
+		ERR_FAIL_NULL(node);
+		available.push_back(node->get_instance_id());
+		pooled_nodes[node->get_instance_id()] = true;
+	}
+}
+
+Node *NodePool::acquire() {
+	while (!available.is_empty()) {
+		Node *node = ObjectDB::get_instance<Node>(available[available.size() - 1]);
+		available.resize(available.size() - 1);
+		if (node) {
+			pooled_nodes[node->get_instance_id()] = false;
+			hit_count++;
+			total_hit_count.increment();
+			return node;
+		}
+	}
+
+	miss_count++;
+	total_miss_count.increment();
+	return _instantiate();
+}
+
+void NodePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	const bool *is_available = pooled_nodes.getptr(p_node->get_instance_id());
+	ERR_FAIL_NULL_MSG(is_available, "Node was not acquired from this NodePool.");
+	ERR_FAIL_COND_MSG(*is_available, "Node was already released to this NodePool.");
+
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+	}
+
+	if ((int)available.size() >= capacity) {
+		_free_node(p_node);
+		return;
+	}
+
+	_reset_to_scene_defaults(p_node);
+	available.push_back(p_node->get_instance_id());
+	pooled_nodes[p_node->get_instance_id()] = true;
+}
+
+void NodePool::clear() {
+	for (const ObjectID &id : available) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			_free_node(node);
+		}
+	}
+	available.clear();
+}
+
+int NodePool::get_available_count() const {
+	return available.size();
+}
+
+void NodePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &NodePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &NodePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_capacity", "capacity"), &NodePool::set_capacity);
+	ClassDB::bind_method(D_METHOD("get_capacity"), &NodePool::get_capacity);
+
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &NodePool::prewarm);
+	ClassDB::bind_method(D_METHOD("acquire"), &NodePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &NodePool::release);
+	ClassDB::bind_method(D_METHOD("clear"), &NodePool::clear);
+
+	ClassDB::bind_method(D_METHOD("get_available_count"), &NodePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("get_hit_count"), &NodePool::get_hit_count);
+	ClassDB::bind_method(D_METHOD("get_miss_count"), &NodePool::get_miss_count);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "capacity", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_capacity", "get_capacity");
+}
+
+NodePool::~NodePool() {
+	clear();
+}
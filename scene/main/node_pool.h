@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*  node_pool.h                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
+#include "scene/resources/packed_scene.h"
+
+class NodePool : public RefCounted {
+	GDCLASS(NodePool, RefCounted);
+
+	struct PropertyState {
+		StringName name;
+		Variant value;
+	};
+
+	struct NodeState {
+		NodePath path;
+		LocalVector<PropertyState> properties;
+	};
+
+	Ref<PackedScene> scene;
+	int capacity = 64;
+
+	// Pristine property values of every node of the scene, taken from the first instance.
+	LocalVector<NodeState> scene_defaults;
+	bool scene_defaults_valid = false;
+
+	LocalVector<ObjectID> available;
+	// Every node created by this pool, mapped to whether it's currently available. Used to validate released nodes.
+	HashMap<ObjectID, bool> pooled_nodes;
+	uint32_t pooled_nodes_prune_size = 256;
+
+	uint64_t hit_count = 0;
+	uint64_t miss_count = 0;
+
+	static inline SafeNumeric<uint64_t> total_hit_count{ 0 };
+	static inline SafeNumeric<uint64_t> total_miss_count{ 0 };
+
+	Node *_instantiate();
+	void _take_scene_defaults(Node *p_root);
+	void _reset_to_scene_defaults(Node *p_root) const;
+	void _free_node(Node *p_node);
+	void _prune_pooled_nodes();
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_scene(const Ref<PackedScene> &p_scene);
+	Ref<PackedScene> get_scene() const;
+
+	void set_capacity(int p_capacity);
+	int get_capacity() const;
+
+	void prewarm(int p_count);
+	Node *acquire();
+	void release(Node *p_node);
+	void clear();
+
+	int get_available_count() const;
+	uint64_t get_hit_count() const { return hit_count; }
+	uint64_t get_miss_count() const { return miss_count; }
+
+	static uint64_t get_total_hit_count() { return total_hit_count.get(); }
+	static uint64_t get_total_miss_count() { return total_miss_count.get(); }
+
+	~NodePool();
+};
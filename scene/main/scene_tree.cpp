@@ -74,15 +74,42 @@ void SceneTreeTimer::_bind_methods() {
 }
 
 void SceneTreeTimer::set_time_left(double p_time) {
-	time_left = p_time;
+	if (tree) {
+		SceneTree *scheduled_tree = tree;
+		scheduled_tree->_unschedule_timer(this);
+		scheduled_tree->_schedule_timer(this, p_time);
+	} else {
+		time_left = p_time;
+	}
 }
 
 double SceneTreeTimer::get_time_left() const {
+	SceneTree *scheduled_tree = tree;
+	if (scheduled_tree) {
+		return scheduled_tree->_get_timer_time_left(this);
+	}
 	return MAX(time_left, 0.0);
 }
 
+void SceneTreeTimer::_set_timeline_flag(bool &r_flag, bool p_value) {
+	if (r_flag == p_value) {
+		return;
+	}
+	if (!tree) {
+		r_flag = p_value;
+		return;
+	}
+
+	// Move the timer to the timeline matching its new flags, keeping the remaining time.
+	SceneTree *scheduled_tree = tree;
+	double remaining = get_time_left();
+	scheduled_tree->_unschedule_timer(this);
+	r_flag = p_value;
+	scheduled_tree->_schedule_timer(this, remaining);
+}
+
 void SceneTreeTimer::set_process_always(bool p_process_always) {
-	process_always = p_process_always;
+	_set_timeline_flag(process_always, p_process_always);
 }
 
 bool SceneTreeTimer::is_process_always() {
@@ -90,7 +117,7 @@ bool SceneTreeTimer::is_process_always() {
 }
 
 void SceneTreeTimer::set_process_in_physics(bool p_process_in_physics) {
-	process_in_physics = p_process_in_physics;
+	_set_timeline_flag(process_in_physics, p_process_in_physics);
 }
 
 bool SceneTreeTimer::is_process_in_physics() {
@@ -98,7 +125,7 @@ bool SceneTreeTimer::is_process_in_physics() {
 }
 
 void SceneTreeTimer::set_ignore_time_scale(bool p_ignore) {
-	ignore_time_scale = p_ignore;
+	_set_timeline_flag(ignore_time_scale, p_ignore);
 }
 
 bool SceneTreeTimer::is_ignoring_time_scale() {
@@ -189,14 +216,39 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	}
 }
 
+void SceneTree::_add_xform_change(SelfList<Node> *p_xform_change) {
+	MutexLock lock(xform_change_mutex);
+	if (!p_xform_change->in_list()) {
+		xform_change_list.add(p_xform_change);
+	}
+}
+
+void SceneTree::_remove_xform_change(SelfList<Node> *p_xform_change) {
+	MutexLock lock(xform_change_mutex);
+	if (p_xform_change->in_list()) {
+		xform_change_list.remove(p_xform_change);
+	}
+}
+
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
-	SelfList<Node> *n = xform_change_list.first();
+	xform_change_epoch.increment();
+
+	SelfList<Node> *n;
+	{
+		MutexLock lock(xform_change_mutex);
+		n = xform_change_list.first();
+	}
 	while (n) {
 		Node *node = n->self();
-		SelfList<Node> *nx = n->next();
-		xform_change_list.remove(n);
+		SelfList<Node> *nx;
+		{
+			// The lock is not held while notifying, as the notification may queue nodes again.
+			MutexLock lock(xform_change_mutex);
+			nx = n->next();
+			xform_change_list.remove(n);
+		}
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
@@ -346,7 +398,46 @@ void SceneTree::_update_group_order(Group &g) {
 	g.changed = false;
 }
 
+void SceneTree::_call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, GroupCallCache *r_cache) {
+	Callable::CallError ce;
+	if (r_cache && !p_node->get_script_instance() && !p_node->_get_extension()) {
+		// Native nodes of the same class share the method lookup, which is the common case for large groups.
+		const StringName &class_name = p_node->get_class_name();
+		if (class_name != r_cache->class_name) {
+			r_cache->class_name = class_name;
+			r_cache->method = ClassDB::get_method(class_name, p_function);
+		}
+		if (r_cache->method) {
+#ifdef DEBUG_ENABLED
+			// Lock as Object::callp() does, so a node freeing itself from the called method is reported.
+			_ObjectDebugLock debug_lock(p_node);
+#endif
+			r_cache->method->call(p_node, p_args, p_argcount, ce);
+		} else {
+			ce.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+		}
+	} else {
+		p_node->callp(p_function, p_args, p_argcount, ce);
+	}
+	if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
+		ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", p_node->get_name(), Variant::get_callable_error_text(Callable(p_node, p_function), p_args, p_argcount, ce)));
+	}
+}
+
+void SceneTree::_call_group_thread(uint32_t p_index, GroupCallTask *p_task) {
+	Node *node = p_task->nodes[p_index];
+	if (nodes_removed_on_group_call.has(node)) {
+		return;
+	}
+	// Let the called node pass its own thread guards, as it would during threaded processing.
+	Node::current_group_call_node = node;
+	_call_group_node(node, p_task->function, p_task->args, p_task->argcount, nullptr);
+	Node::current_group_call_node = nullptr;
+}
+
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
+	ERR_FAIL_COND_MSG((p_call_flags & GROUP_CALL_PARALLEL) && (p_call_flags & GROUP_CALL_DEFERRED), "GROUP_CALL_PARALLEL can't be combined with GROUP_CALL_DEFERRED.");
+
 	Vector<Node *> nodes_copy;
 
 	{
@@ -385,15 +476,28 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	// The copy shares the group's buffer, so no allocation happens unless the group changes during the calls.
+	Node **gr_nodes = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
 	int gr_node_count = nodes_copy.size();
 
+	// "free" is not a bound method, it must go through Object::callp.
+	GroupCallCache cache;
+	GroupCallCache *cache_ptr = p_function != CoreStringName(free_) ? &cache : nullptr;
+
 	{
 		_THREAD_SAFE_METHOD_
 		nodes_removed_on_group_call_lock++;
 	}
 
-	if (p_call_flags & GROUP_CALL_REVERSE) {
+	if (p_call_flags & GROUP_CALL_PARALLEL) {
+		GroupCallTask task;
+		task.nodes = gr_nodes;
+		task.function = p_function;
+		task.args = p_args;
+		task.argcount = p_argcount;
+		WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_call_group_thread, &task, gr_node_count, -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+	} else if (p_call_flags & GROUP_CALL_REVERSE) {
 		for (int i = gr_node_count - 1; i >= 0; i--) {
 			if (nodes_removed_on_group_call_lock && nodes_removed_on_group_call.has(gr_nodes[i])) {
 				continue;
@@ -401,11 +505,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 
 			Node *node = gr_nodes[i];
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				node->callp(p_function, p_args, p_argcount, ce);
-				if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
-					ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", node->get_name(), Variant::get_callable_error_text(Callable(node, p_function), p_args, p_argcount, ce)));
-				}
+				_call_group_node(node, p_function, p_args, p_argcount, cache_ptr);
 			} else {
 				MessageQueue::get_singleton()->push_callp(node, p_function, p_args, p_argcount);
 			}
@@ -419,11 +519,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 
 			Node *node = gr_nodes[i];
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				node->callp(p_function, p_args, p_argcount, ce);
-				if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
-					ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", node->get_name(), Variant::get_callable_error_text(Callable(node, p_function), p_args, p_argcount, ce)));
-				}
+				_call_group_node(node, p_function, p_args, p_argcount, cache_ptr);
 			} else {
 				MessageQueue::get_singleton()->push_callp(node, p_function, p_args, p_argcount);
 			}
@@ -457,7 +553,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node **gr_nodes = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -519,7 +615,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 
 		nodes_copy = g.nodes;
 	}
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node **gr_nodes = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -777,35 +873,131 @@ bool SceneTree::process(double p_time) {
 	return _quit;
 }
 
+uint32_t SceneTree::_get_timer_timeline(const SceneTreeTimer *p_timer) {
+	uint32_t timeline = 0;
+	if (p_timer->process_always) {
+		timeline |= TIMER_TIMELINE_PROCESS_ALWAYS;
+	}
+	if (p_timer->ignore_time_scale) {
+		timeline |= TIMER_TIMELINE_IGNORE_TIME_SCALE;
+	}
+	if (p_timer->process_in_physics) {
+		timeline |= TIMER_TIMELINE_PHYSICS;
+	}
+	return timeline;
+}
+
+void SceneTree::_schedule_timer(SceneTreeTimer *p_timer, double p_time_left) {
+	_THREAD_SAFE_METHOD_
+	TimerTimeline &tl = timer_timelines[_get_timer_timeline(p_timer)];
+
+	p_timer->tree = this;
+	p_timer->timeline = _get_timer_timeline(p_timer);
+	p_timer->deadline = tl.clock + p_time_left;
+	p_timer->schedule_version++;
+	p_timer->in_heap = true;
+
+	TimerEntry entry;
+	entry.deadline = p_timer->deadline;
+	entry.creation_order = p_timer->creation_order;
+	entry.version = p_timer->schedule_version;
+	entry.timer = Ref<SceneTreeTimer>(p_timer);
+
+	SortArray<TimerEntry, TimerEntryHeapSort> sorter;
+	tl.heap.push_back(entry);
+	sorter.push_heap(0, tl.heap.size() - 1, 0, entry, tl.heap.ptr());
+}
+
+void SceneTree::_unschedule_timer(SceneTreeTimer *p_timer) {
+	_THREAD_SAFE_METHOD_
+	// The heap entry is left in place and skipped once its version no longer matches.
+	p_timer->time_left = p_timer->get_time_left();
+	p_timer->tree = nullptr;
+	p_timer->schedule_version++;
+	if (p_timer->in_heap) {
+		// Expired timers waiting for their timeout were already popped, and left nothing behind.
+		timer_timelines[p_timer->timeline].stale_count++;
+		p_timer->in_heap = false;
+	}
+}
+
+double SceneTree::_get_timer_time_left(const SceneTreeTimer *p_timer) const {
+	_THREAD_SAFE_METHOD_
+	if (p_timer->tree != this) {
+		return MAX(p_timer->time_left, 0.0); // Unscheduled in the meantime.
+	}
+	return MAX(p_timer->deadline - timer_timelines[p_timer->timeline].clock, 0.0);
+}
+
+void SceneTree::_compact_timer_timeline(uint32_t p_timeline) {
+	TimerTimeline &tl = timer_timelines[p_timeline];
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < tl.heap.size(); i++) {
+		const TimerEntry &entry = tl.heap[i];
+		if (entry.timer->tree == this && entry.timer->timeline == p_timeline && entry.timer->schedule_version == entry.version) {
+			if (count != i) {
+				tl.heap[count] = entry;
+			}
+			count++;
+		}
+	}
+	tl.heap.resize(count);
+	tl.stale_count = 0;
+
+	SortArray<TimerEntry, TimerEntryHeapSort> sorter;
+	sorter.make_heap(0, tl.heap.size(), tl.heap.ptr());
+}
+
 void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
 	_THREAD_SAFE_METHOD_
-	const List<Ref<SceneTreeTimer>>::Element *L = timers.back(); // Last element.
 	const double unscaled_delta = Engine::get_singleton()->get_process_step();
+	SortArray<TimerEntry, TimerEntryHeapSort> sorter;
 
-	for (List<Ref<SceneTreeTimer>>::Element *E = timers.front(); E;) {
-		List<Ref<SceneTreeTimer>>::Element *N = E->next();
-		Ref<SceneTreeTimer> timer = E->get();
+	// Collect expired timers first, so timers created or restarted from a timeout callback wait for the next frame.
+	LocalVector<TimerEntry> expired;
 
-		if ((paused && !timer->is_process_always()) || (timer->is_process_in_physics() != p_physics_frame)) {
-			if (E == L) {
-				break; // Break on last, so if new timers were added during list traversal, ignore them.
-			}
-			E = N;
+	for (uint32_t i = 0; i < TIMER_TIMELINE_PHYSICS; i++) {
+		if (paused && !(i & TIMER_TIMELINE_PROCESS_ALWAYS)) {
 			continue;
 		}
 
-		double time_left = timer->get_time_left();
-		time_left -= timer->is_ignoring_time_scale() ? unscaled_delta : p_delta;
-		timer->set_time_left(time_left);
+		uint32_t timeline = p_physics_frame ? (i | TIMER_TIMELINE_PHYSICS) : i;
+		TimerTimeline &tl = timer_timelines[timeline];
+		tl.clock += (i & TIMER_TIMELINE_IGNORE_TIME_SCALE) ? unscaled_delta : p_delta;
 
-		if (time_left <= 0) {
-			E->get()->emit_signal(SNAME("timeout"));
-			timers.erase(E);
+		while (!tl.heap.is_empty() && tl.heap[0].deadline <= tl.clock) {
+			sorter.pop_heap(0, tl.heap.size(), tl.heap.ptr());
+			TimerEntry &entry = tl.heap[tl.heap.size() - 1];
+			if (entry.timer->schedule_version == entry.version) {
+				entry.timer->in_heap = false;
+				expired.push_back(entry);
+			} else if (tl.stale_count > 0) {
+				tl.stale_count--;
+			}
+			tl.heap.remove_at(tl.heap.size() - 1);
 		}
-		if (E == L) {
-			break; // Break on last, so if new timers were added during list traversal, ignore them.
+
+		if (tl.stale_count > 64 && tl.stale_count * 2 > tl.heap.size()) {
+			_compact_timer_timeline(timeline);
 		}
-		E = N;
+	}
+
+	if (expired.is_empty()) {
+		return;
+	}
+
+	// Emit in creation order, as timers expiring on the same frame always did.
+	expired.sort_custom<TimerEntryCreationSort>();
+
+	for (const TimerEntry &entry : expired) {
+		SceneTreeTimer *timer = entry.timer.ptr();
+		if (timer->schedule_version != entry.version) {
+			continue; // Restarted by a previous timeout callback.
+		}
+		timer->tree = nullptr;
+		timer->time_left = 0.0;
+		timer->schedule_version++;
+		timer->emit_signal(SNAME("timeout"));
 	}
 }
 
@@ -858,10 +1050,16 @@ void SceneTree::finalize() {
 	MainLoop::finalize();
 
 	// Cleanup timers.
-	for (Ref<SceneTreeTimer> &timer : timers) {
-		timer->release_connections();
+	for (TimerTimeline &tl : timer_timelines) {
+		for (TimerEntry &entry : tl.heap) {
+			if (entry.timer->tree == this && entry.timer->schedule_version == entry.version) {
+				entry.timer->tree = nullptr;
+				entry.timer->release_connections();
+			}
+		}
+		tl.heap.clear();
+		tl.stale_count = 0;
 	}
-	timers.clear();
 
 	// Cleanup tweens.
 	for (Ref<Tween> &tween : tweens) {
@@ -1146,10 +1344,14 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	// When reading this function, keep in mind that this code must work in a way where
 	// if any node is removed, this needs to continue working.
 
+	uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+	uint64_t &process_usec = p_physics ? p_group->physics_process_usec : p_group->process_usec;
+
 	p_group->call_queue.flush(); // Flush messages before processing.
 
 	Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
 	if (nodes.is_empty()) {
+		process_usec = OS::get_singleton()->get_ticks_usec() - begin_usec;
 		return;
 	}
 
@@ -1201,6 +1403,8 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	}
 
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+
+	process_usec = OS::get_singleton()->get_ticks_usec() - begin_usec;
 }
 
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
@@ -1278,6 +1482,12 @@ void SceneTree::_process(bool p_physics) {
 				}
 
 				if (using_threads) {
+					// Start the most expensive groups first, so a heavy group picked up last does not stall the whole batch.
+					if (p_physics) {
+						local_process_group_cache.sort_custom<ProcessGroupCostSort<true>>();
+					} else {
+						local_process_group_cache.sort_custom<ProcessGroupCostSort<false>>();
+					}
 					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
 				}
@@ -1318,6 +1528,10 @@ void SceneTree::_process(bool p_physics) {
 		if (process_valid) {
 			pg->last_pass = process_last_pass; // Enable for processing
 			process_count++;
+		} else if (p_physics) {
+			pg->physics_process_usec = 0; // Not processed in this pass, don't report an earlier one.
+		} else {
+			pg->process_usec = 0;
 		}
 	}
 
@@ -1616,6 +1830,25 @@ int SceneTree::get_node_count() const {
 	return nodes_in_tree_count;
 }
 
+TypedArray<Dictionary> SceneTree::get_process_group_profile() const {
+	TypedArray<Dictionary> ret;
+	for (const ProcessGroup *pg : process_groups) {
+		if (pg->removed) {
+			continue;
+		}
+		Dictionary d;
+		d["owner"] = pg->owner ? Variant(pg->owner) : Variant();
+		d["order"] = pg->owner ? pg->owner->data.process_thread_group_order : 0;
+		d["threaded"] = pg->owner != nullptr && pg->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD && !node_threading_disabled;
+		d["node_count"] = pg->nodes.size();
+		d["physics_node_count"] = pg->physics_nodes.size();
+		d["process_usec"] = pg->process_usec;
+		d["physics_process_usec"] = pg->physics_process_usec;
+		ret.push_back(d);
+	}
+	return ret;
+}
+
 void SceneTree::set_edited_scene_root(Node *p_node) {
 #ifdef TOOLS_ENABLED
 	edited_scene_root = p_node;
@@ -1733,10 +1966,10 @@ Ref<SceneTreeTimer> SceneTree::create_timer(double p_delay_sec, bool p_process_a
 	Ref<SceneTreeTimer> stt;
 	stt.instantiate();
 	stt->set_process_always(p_process_always);
-	stt->set_time_left(p_delay_sec);
 	stt->set_process_in_physics(p_process_in_physics);
 	stt->set_ignore_time_scale(p_ignore_time_scale);
-	timers.push_back(stt);
+	stt->creation_order = timer_creation_counter++;
+	_schedule_timer(stt.ptr(), p_delay_sec);
 	return stt;
 }
 
@@ -1880,6 +2113,7 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_processed_tweens"), &SceneTree::get_processed_tweens);
 
 	ClassDB::bind_method(D_METHOD("get_node_count"), &SceneTree::get_node_count);
+	ClassDB::bind_method(D_METHOD("get_process_group_profile"), &SceneTree::get_process_group_profile);
 	ClassDB::bind_method(D_METHOD("get_frame"), &SceneTree::get_frame);
 	ClassDB::bind_method(D_METHOD("quit", "exit_code"), &SceneTree::quit, DEFVAL(EXIT_SUCCESS));
 
@@ -1954,6 +2188,7 @@ void SceneTree::_bind_methods() {
 	BIND_ENUM_CONSTANT(GROUP_CALL_REVERSE);
 	BIND_ENUM_CONSTANT(GROUP_CALL_DEFERRED);
 	BIND_ENUM_CONSTANT(GROUP_CALL_UNIQUE);
+	BIND_ENUM_CONSTANT(GROUP_CALL_PARALLEL);
 }
 
 SceneTree *SceneTree::singleton = nullptr;
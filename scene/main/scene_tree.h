@@ -32,6 +32,7 @@
 
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
 #include "core/templates/self_list.h"
 #include "scene/main/scene_tree_fti.h"
@@ -49,17 +50,30 @@ class Material;
 class Mesh;
 class MultiplayerAPI;
 class SceneDebugger;
+class SceneTree;
 class Tween;
 class Viewport;
 
 class SceneTreeTimer : public RefCounted {
 	GDCLASS(SceneTreeTimer, RefCounted);
 
+	friend class SceneTree;
+
 	double time_left = 0.0;
 	bool process_always = true;
 	bool process_in_physics = false;
 	bool ignore_time_scale = false;
 
+	// Scheduling state, only valid while the timer is queued in a SceneTree.
+	SceneTree *tree = nullptr;
+	double deadline = 0.0;
+	uint64_t creation_order = 0;
+	uint32_t timeline = 0;
+	uint32_t schedule_version = 0;
+	bool in_heap = false; // The heap entry for schedule_version has not been popped yet.
+
+	void _set_timeline_flag(bool &r_flag, bool p_value);
+
 protected:
 	static void _bind_methods();
 
@@ -99,12 +113,22 @@ private:
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+		uint64_t process_usec = 0; // Time spent in the last process pass, zero if the group was skipped.
+		uint64_t physics_process_usec = 0; // Time spent in the last physics process pass, zero if the group was skipped.
 	};
 
 	struct ProcessGroupSort {
 		_FORCE_INLINE_ bool operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const;
 	};
 
+	// Orders threaded groups by decreasing cost of their last pass, so the heaviest ones are picked up by worker threads first.
+	template <bool p_physics>
+	struct ProcessGroupCostSort {
+		_FORCE_INLINE_ bool operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const {
+			return p_physics ? p_left->physics_process_usec > p_right->physics_process_usec : p_left->process_usec > p_right->process_usec;
+		}
+	};
+
 	PagedAllocator<ProcessGroup, true> group_allocator; // Allocate groups on pages, to enhance cache usage.
 
 	LocalVector<ProcessGroup *> process_groups;
@@ -213,7 +237,49 @@ private:
 
 	void _flush_scene_change();
 
-	List<Ref<SceneTreeTimer>> timers;
+	// Timers are kept in one min-heap per timeline (physics or idle, scaled or unscaled, pausable or not).
+	// Each timeline has its own clock, so a frame only advances a few clocks and pops the timers that expired.
+	enum {
+		TIMER_TIMELINE_PROCESS_ALWAYS = 1,
+		TIMER_TIMELINE_IGNORE_TIME_SCALE = 2,
+		TIMER_TIMELINE_PHYSICS = 4,
+		TIMER_TIMELINE_MAX = 8,
+	};
+
+	struct TimerEntry {
+		double deadline = 0.0;
+		uint64_t creation_order = 0;
+		uint32_t version = 0;
+		Ref<SceneTreeTimer> timer;
+	};
+
+	struct TimerEntryHeapSort {
+		_FORCE_INLINE_ bool operator()(const TimerEntry &p_left, const TimerEntry &p_right) const { // Returns true when p_left expires after p_right.
+			return p_left.deadline > p_right.deadline || (p_left.deadline == p_right.deadline && p_left.creation_order > p_right.creation_order);
+		}
+	};
+
+	struct TimerEntryCreationSort {
+		_FORCE_INLINE_ bool operator()(const TimerEntry &p_left, const TimerEntry &p_right) const {
+			return p_left.creation_order < p_right.creation_order;
+		}
+	};
+
+	struct TimerTimeline {
+		double clock = 0.0;
+		LocalVector<TimerEntry> heap;
+		uint32_t stale_count = 0; // Entries left behind by rescheduled timers.
+	};
+
+	TimerTimeline timer_timelines[TIMER_TIMELINE_MAX];
+	uint64_t timer_creation_counter = 0;
+
+	static uint32_t _get_timer_timeline(const SceneTreeTimer *p_timer);
+	void _schedule_timer(SceneTreeTimer *p_timer, double p_time_left);
+	void _unschedule_timer(SceneTreeTimer *p_timer);
+	double _get_timer_time_left(const SceneTreeTimer *p_timer) const;
+	void _compact_timer_timeline(uint32_t p_timeline);
+
 	List<Ref<Tween>> tweens;
 
 	///network///
@@ -224,6 +290,7 @@ private:
 
 	static SceneTree *singleton;
 	friend class Node;
+	friend class SceneTreeTimer;
 
 	void tree_changed();
 	void node_added(Node *p_node);
@@ -235,6 +302,21 @@ private:
 	Group *add_to_group(const StringName &p_group, Node *p_node);
 	void remove_from_group(const StringName &p_group, Node *p_node);
 
+	struct GroupCallCache {
+		StringName class_name;
+		MethodBind *method = nullptr;
+	};
+
+	struct GroupCallTask {
+		Node **nodes = nullptr;
+		StringName function;
+		const Variant **args = nullptr;
+		int argcount = 0;
+	};
+
+	void _call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, GroupCallCache *r_cache);
+	void _call_group_thread(uint32_t p_index, GroupCallTask *p_task);
+
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
 	void _process(bool p_physics);
@@ -253,7 +335,14 @@ private:
 	friend class Node3D;
 	friend class Viewport;
 
+	// Nodes may be queued from process group threads and parallel group calls, so the list is only modified under the mutex.
 	SelfList<Node>::List xform_change_list;
+	BinaryMutex xform_change_mutex;
+	// Bumped whenever nodes may leave xform_change_list, see Node3D::_propagate_transform_changed().
+	SafeNumeric<uint32_t> xform_change_epoch{ 1 };
+
+	void _add_xform_change(SelfList<Node> *p_xform_change);
+	void _remove_xform_change(SelfList<Node> *p_xform_change);
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -295,6 +384,7 @@ public:
 		GROUP_CALL_REVERSE = 1,
 		GROUP_CALL_DEFERRED = 2,
 		GROUP_CALL_UNIQUE = 4,
+		GROUP_CALL_PARALLEL = 8,
 	};
 
 	_FORCE_INLINE_ Window *get_root() const { return root; }
@@ -405,6 +495,7 @@ public:
 	int64_t get_frame() const;
 
 	int get_node_count() const;
+	TypedArray<Dictionary> get_process_group_profile() const;
 
 	void queue_delete(Object *p_object);
 
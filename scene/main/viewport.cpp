@@ -711,6 +711,24 @@ void Viewport::_notification(int p_what) {
 }
 
 #if !defined(PHYSICS_2D_DISABLED) || !defined(PHYSICS_3D_DISABLED)
+void Viewport::_push_physics_picking_event(const Ref<InputEvent> &p_event) {
+	// Motion events queued between two physics frames only need to be picked once, at their final position.
+	// Merge them the same way Input accumulates motion, so hovering thousands of colliders doesn't run one query per event.
+	Ref<InputEventMouseMotion> mm = p_event;
+	if (mm.is_valid() && !physics_picking_events.is_empty() && Input::get_singleton()->is_using_accumulated_input()) {
+		Ref<InputEventMouseMotion> last = physics_picking_events.back()->get();
+		if (last.is_valid() && last->get_device() == mm->get_device()) {
+			// Don't modify the queued event, it was already delivered to nodes which may keep a reference to it.
+			Ref<InputEventMouseMotion> merged = last->duplicate();
+			if (merged->accumulate(mm)) {
+				physics_picking_events.back()->get() = merged;
+				return;
+			}
+		}
+	}
+	physics_picking_events.push_back(p_event);
+}
+
 void Viewport::_process_picking() {
 	if (!is_inside_tree()) {
 		return;
@@ -751,6 +769,11 @@ void Viewport::_process_picking() {
 
 #ifndef PHYSICS_2D_DISABLED
 	PhysicsDirectSpaceState2D *ss2d = PhysicsServer2D::get_singleton()->space_get_direct_state(find_world_2d()->get_space());
+
+	// Results of the last 2D query for each canvas layer, reused by consecutive events at the same position (e.g. a motion followed by a click).
+	Vector2 last_pos_2d(1e20, 1e20);
+	LocalVector<PhysicsDirectSpaceState2D::ShapeResult> last_results_2d;
+	LocalVector<uint32_t> last_result_offsets_2d;
 #endif // PHYSICS_2D_DISABLED
 
 	SubViewportContainer *parent_svc = Object::cast_to<SubViewportContainer>(get_parent());
@@ -837,47 +860,71 @@ void Viewport::_process_picking() {
 
 			uint64_t frame = get_tree()->get_frame();
 
+			const bool reuse_results = pos == last_pos_2d && last_result_offsets_2d.size() == canvas_layers.size() + 1;
+			if (!reuse_results) {
+				last_pos_2d = pos;
+				last_results_2d.clear();
+				last_result_offsets_2d.clear();
+				last_result_offsets_2d.push_back(0);
+			}
+			uint32_t layer_index = 0;
+
 			PhysicsDirectSpaceState2D::ShapeResult res[64];
 			for (const CanvasLayer *E : canvas_layers) {
-				Transform2D canvas_layer_transform;
-				ObjectID canvas_layer_id;
-				if (E) {
-					// A descendant CanvasLayer.
-					canvas_layer_transform = E->get_final_transform();
-					canvas_layer_id = E->get_instance_id();
+				int rc = 0;
+				if (reuse_results) {
+					// Colliders may have been freed by a previous event, so refresh them from their IDs.
+					for (uint32_t i = last_result_offsets_2d[layer_index]; i < last_result_offsets_2d[layer_index + 1]; i++) {
+						res[rc] = last_results_2d[i];
+						res[rc].collider = ObjectDB::get_instance(res[rc].collider_id);
+						rc++;
+					}
+					layer_index++;
 				} else {
-					// This Viewport's builtin canvas.
-					canvas_layer_transform = get_canvas_transform();
-					canvas_layer_id = ObjectID();
-				}
+					Transform2D canvas_layer_transform;
+					ObjectID canvas_layer_id;
+					if (E) {
+						// A descendant CanvasLayer.
+						canvas_layer_transform = E->get_final_transform();
+						canvas_layer_id = E->get_instance_id();
+					} else {
+						// This Viewport's builtin canvas.
+						canvas_layer_transform = get_canvas_transform();
+						canvas_layer_id = ObjectID();
+					}
 
-				Vector2 point = canvas_layer_transform.affine_inverse().xform(pos);
-
-				PhysicsDirectSpaceState2D::PointParameters point_params;
-				point_params.position = point;
-				point_params.canvas_instance_id = canvas_layer_id;
-				point_params.collide_with_areas = true;
-				point_params.pick_point = true;
-
-				int rc = ss2d->intersect_point(point_params, res, 64);
-				if (physics_object_picking_sort) {
-					struct ComparatorCollisionObjects {
-						bool operator()(const PhysicsDirectSpaceState2D::ShapeResult &p_a, const PhysicsDirectSpaceState2D::ShapeResult &p_b) const {
-							CollisionObject2D *a = Object::cast_to<CollisionObject2D>(p_a.collider);
-							CollisionObject2D *b = Object::cast_to<CollisionObject2D>(p_b.collider);
-							if (!a || !b) {
-								return false;
-							}
-							int za = a->get_effective_z_index();
-							int zb = b->get_effective_z_index();
-							if (za != zb) {
-								return zb < za;
+					Vector2 point = canvas_layer_transform.affine_inverse().xform(pos);
+
+					PhysicsDirectSpaceState2D::PointParameters point_params;
+					point_params.position = point;
+					point_params.canvas_instance_id = canvas_layer_id;
+					point_params.collide_with_areas = true;
+					point_params.pick_point = true;
+
+					rc = ss2d->intersect_point(point_params, res, 64);
+					if (physics_object_picking_sort) {
+						struct ComparatorCollisionObjects {
+							bool operator()(const PhysicsDirectSpaceState2D::ShapeResult &p_a, const PhysicsDirectSpaceState2D::ShapeResult &p_b) const {
+								CollisionObject2D *a = Object::cast_to<CollisionObject2D>(p_a.collider);
+								CollisionObject2D *b = Object::cast_to<CollisionObject2D>(p_b.collider);
+								if (!a || !b) {
+									return false;
+								}
+								int za = a->get_effective_z_index();
+								int zb = b->get_effective_z_index();
+								if (za != zb) {
+									return zb < za;
+								}
+								return a->is_greater_than(b);
 							}
-							return a->is_greater_than(b);
-						}
-					};
-					SortArray<PhysicsDirectSpaceState2D::ShapeResult, ComparatorCollisionObjects> sorter;
-					sorter.sort(res, rc);
+						};
+						SortArray<PhysicsDirectSpaceState2D::ShapeResult, ComparatorCollisionObjects> sorter;
+						sorter.sort(res, rc);
+					}
+					for (int i = 0; i < rc; i++) {
+						last_results_2d.push_back(res[i]);
+					}
+					last_result_offsets_2d.push_back(last_results_2d.size());
 				}
 				for (int i = 0; i < rc; i++) {
 					if (is_input_handled()) {
@@ -3514,7 +3561,7 @@ void Viewport::_push_unhandled_input_internal(const Ref<InputEvent> &p_event) {
 						Object::cast_to<InputEventScreenTouch>(*p_event)
 
 								)) {
-			physics_picking_events.push_back(p_event);
+			_push_physics_picking_event(p_event);
 			set_input_as_handled();
 		}
 	}
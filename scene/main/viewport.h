@@ -510,6 +510,7 @@ protected:
 
 	void _notification(int p_what);
 #if !defined(PHYSICS_2D_DISABLED) || !defined(PHYSICS_3D_DISABLED)
+	void _push_physics_picking_event(const Ref<InputEvent> &p_event);
 	void _process_picking();
 #endif // !defined(PHYSICS_2D_DISABLED) || !defined(PHYSICS_3D_DISABLED)
 	static void _bind_methods();
@@ -5336,6 +5336,21 @@ bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track,
 	return true;
 }
 
+int32_t Animation::_find_compressed_page(double p_time) const {
+	// Pages are sorted by time offset, so binary search the last one starting at or before p_time.
+	uint32_t lo = 0;
+	uint32_t hi = compression.pages.size();
+	while (lo < hi) {
+		const uint32_t mid = (lo + hi) / 2;
+		if (compression.pages[mid].time_offset > p_time) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+	return int32_t(lo) - 1;
+}
+
 template <uint32_t COMPONENTS>
 bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
 	ERR_FAIL_COND_V(!compression.enabled, false);
@@ -5347,13 +5362,7 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
-	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
-		}
-		page_index = i;
-	}
+	int32_t page_index = _find_compressed_page(p_time);
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
 
@@ -5368,21 +5377,39 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
 	uint32_t base_frame = time_keys[0];
 
-	for (uint32_t i = 1; i < time_key_count; i++) {
-		uint32_t f = time_keys[i * 2 + 0];
-		double frame_time = double(f) * frame_to_sec + page_base_time;
+	if (key_index) {
+		// The key index is the sum of the key counts of all previous packets, so walk them.
+		for (uint32_t i = 1; i < time_key_count; i++) {
+			uint32_t f = time_keys[i * 2 + 0];
+			double frame_time = double(f) * frame_to_sec + page_base_time;
 
-		if (frame_time > p_time) {
-			break;
-		}
+			if (frame_time > p_time) {
+				break;
+			}
 
-		if (key_index) {
 			(*key_index) += (time_keys[(i - 1) * 2 + 1] >> 12) + 1;
-		}
 
-		packet_idx = i;
-		packet_time = frame_time;
-		base_frame = f;
+			packet_idx = i;
+			packet_time = frame_time;
+			base_frame = f;
+		}
+	} else {
+		// Packets are sorted by frame, so binary search the last one starting at or before p_time.
+		uint32_t lo = 1;
+		uint32_t hi = time_key_count;
+		while (lo < hi) {
+			const uint32_t mid = (lo + hi) / 2;
+			if (double(time_keys[mid * 2 + 0]) * frame_to_sec + page_base_time > p_time) {
+				hi = mid;
+			} else {
+				lo = mid + 1;
+			}
+		}
+		if (lo > 1) {
+			packet_idx = lo - 1;
+			base_frame = time_keys[packet_idx * 2 + 0];
+			packet_time = double(base_frame) * frame_to_sec + page_base_time;
+		}
 	}
 
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
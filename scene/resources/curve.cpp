@@ -906,6 +906,34 @@ Vector2 Curve2D::_calculate_tangent(const Vector2 &p_begin, const Vector2 &p_con
 	return p_begin.bezier_derivative(p_control_1, p_control_2, p_end, p_t).normalized();
 }
 
+// Maps evenly sized buckets of the baked length to the first interval ending in each of them,
+// so intervals can be found without a binary search.
+static void _update_baked_dist_lookup(const Vector<real_t> &p_dists, real_t p_max_ofs, Vector<int32_t> &r_lookup, real_t &r_scale) {
+	int pc = p_dists.size();
+	if (pc < 2) {
+		r_lookup.clear();
+		r_scale = 0.0;
+		return;
+	}
+
+	int lookup_size = pc - 1;
+	r_lookup.resize(lookup_size);
+	r_scale = p_max_ofs > 0.0 ? lookup_size / p_max_ofs : 0.0;
+
+	const real_t *dists = p_dists.ptr();
+	int32_t *lookup = r_lookup.ptrw();
+	int bucket = 0;
+	for (int i = 0; i < pc - 1 && bucket < lookup_size; i++) {
+		int last_bucket = MIN(int(dists[i + 1] * r_scale), lookup_size - 1);
+		while (bucket <= last_bucket) {
+			lookup[bucket++] = i;
+		}
+	}
+	while (bucket < lookup_size) {
+		lookup[bucket++] = pc - 2;
+	}
+}
+
 void Curve2D::_bake() const {
 	if (!baked_cache_dirty) {
 		return;
@@ -917,6 +945,7 @@ void Curve2D::_bake() const {
 	if (points.is_empty()) {
 		baked_point_cache.clear();
 		baked_dist_cache.clear();
+		baked_dist_lookup.clear();
 		baked_forward_vector_cache.clear();
 		return;
 	}
@@ -928,6 +957,7 @@ void Curve2D::_bake() const {
 		baked_dist_cache.set(0, 0.0);
 		baked_forward_vector_cache.resize(1);
 		baked_forward_vector_cache.set(0, Vector2(0.0, 0.1));
+		baked_dist_lookup.clear();
 
 		return;
 	}
@@ -973,6 +1003,7 @@ void Curve2D::_bake() const {
 			bdw[i + 1] = bdw[i] + bpw[i].distance_to(bpw[i + 1]);
 		}
 		baked_max_ofs = bdw[pc - 1];
+		_update_baked_dist_lookup(baked_dist_cache, baked_max_ofs, baked_dist_lookup, baked_dist_lookup_scale);
 	}
 }
 
@@ -994,22 +1025,17 @@ Curve2D::Interval Curve2D::_find_interval(real_t p_offset) const {
 	int pc = baked_point_cache.size();
 	ERR_FAIL_COND_V_MSG(pc < 2, interval, "Less than two points in cache");
 
-	int start = 0;
-	int end = pc;
-	int idx = (end + start) / 2;
-	// Binary search to find baked points.
-	while (start < idx) {
-		real_t offset = baked_dist_cache[idx];
-		if (p_offset <= offset) {
-			end = idx;
-		} else {
-			start = idx;
-		}
-		idx = (end + start) / 2;
+	// Jump to the first interval that can contain the offset, then walk forward.
+	// Baked points are (almost) evenly spaced, so this rarely takes more than a step.
+	const real_t *dists = baked_dist_cache.ptr();
+	int bucket = CLAMP(int(p_offset * baked_dist_lookup_scale), 0, baked_dist_lookup.size() - 1);
+	int idx = baked_dist_lookup[bucket];
+	while (idx < pc - 2 && dists[idx + 1] < p_offset) {
+		idx++;
 	}
 
-	real_t offset_begin = baked_dist_cache[idx];
-	real_t offset_end = baked_dist_cache[idx + 1];
+	real_t offset_begin = dists[idx];
+	real_t offset_end = dists[idx + 1];
 
 	real_t idx_interval = offset_end - offset_begin;
 	ERR_FAIL_COND_V_MSG(p_offset < offset_begin || p_offset > offset_end, interval, "Offset out of range.");
@@ -1115,6 +1141,47 @@ Transform2D Curve2D::sample_baked_with_rotation(real_t p_offset, bool p_cubic) c
 	return frame;
 }
 
+TypedArray<Transform2D> Curve2D::sample_baked_with_rotation_batch(const PackedFloat32Array &p_offsets, bool p_cubic) const {
+	TypedArray<Transform2D> transforms;
+
+	if (baked_cache_dirty) {
+		_bake();
+	}
+
+	// Every element matches what sample_baked_with_rotation() returns for the same offset,
+	// so failed samples are left as identity transforms instead of being dropped.
+	const int offset_count = p_offsets.size();
+	const float *offsets = p_offsets.ptr();
+	transforms.resize(offset_count);
+
+	// Validate: Curve may not have baked points.
+	const int point_count = baked_point_cache.size();
+	ERR_FAIL_COND_V_MSG(point_count == 0, transforms, "No points in Curve2D.");
+
+	if (point_count == 1) {
+		Transform2D t;
+		t.set_origin(baked_point_cache.get(0));
+		for (int i = 0; i < offset_count; i++) {
+			if (Math::is_finite(offsets[i])) {
+				transforms[i] = t;
+			}
+		}
+		ERR_FAIL_V_MSG(transforms, "Only 1 point in Curve2D.");
+	}
+
+	for (int i = 0; i < offset_count; i++) {
+		ERR_CONTINUE_MSG(!Math::is_finite(offsets[i]), "Offset is non-finite");
+
+		const real_t offset = CLAMP((real_t)offsets[i], 0.0, baked_max_ofs);
+		Curve2D::Interval interval = _find_interval(offset);
+		Transform2D frame = _sample_posture(interval);
+		frame.set_origin(_sample_baked(interval, p_cubic));
+		transforms[i] = frame;
+	}
+
+	return transforms;
+}
+
 PackedVector2Array Curve2D::get_baked_points() const {
 	if (baked_cache_dirty) {
 		_bake();
@@ -1420,6 +1487,7 @@ void Curve2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_baked_length"), &Curve2D::get_baked_length);
 	ClassDB::bind_method(D_METHOD("sample_baked", "offset", "cubic"), &Curve2D::sample_baked, DEFVAL(0.0), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("sample_baked_with_rotation", "offset", "cubic"), &Curve2D::sample_baked_with_rotation, DEFVAL(0.0), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("sample_baked_with_rotation_batch", "offsets", "cubic"), &Curve2D::sample_baked_with_rotation_batch, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_baked_points"), &Curve2D::get_baked_points);
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_point"), &Curve2D::get_closest_point);
 	ClassDB::bind_method(D_METHOD("get_closest_offset", "to_point"), &Curve2D::get_closest_offset);
@@ -1672,6 +1740,7 @@ void Curve3D::_bake() const {
 		baked_point_cache.clear();
 		baked_tilt_cache.clear();
 		baked_dist_cache.clear();
+		baked_dist_lookup.clear();
 
 		baked_forward_vector_cache.clear();
 		baked_up_vector_cache.clear();
@@ -1690,6 +1759,7 @@ void Curve3D::_bake() const {
 		baked_tilt_cache.set(0, points[0].tilt);
 		baked_dist_cache.resize(1);
 		baked_dist_cache.set(0, 0.0);
+		baked_dist_lookup.clear();
 		baked_forward_vector_cache.resize(1);
 		baked_forward_vector_cache.set(0, Vector3(0.0, 0.0, 1.0));
 
@@ -1771,6 +1841,7 @@ void Curve3D::_bake() const {
 			bdw[i + 1] = bdw[i] + bpw[i].distance_to(bpw[i + 1]);
 		}
 		baked_max_ofs = bdw[pc - 1];
+		_update_baked_dist_lookup(baked_dist_cache, baked_max_ofs, baked_dist_lookup, baked_dist_lookup_scale);
 	}
 
 	if (!up_vector_enabled) {
@@ -1875,22 +1946,17 @@ Curve3D::Interval Curve3D::_find_interval(real_t p_offset) const {
 	int pc = baked_point_cache.size();
 	ERR_FAIL_COND_V_MSG(pc < 2, interval, "Less than two points in cache");
 
-	int start = 0;
-	int end = pc;
-	int idx = (end + start) / 2;
-	// Binary search to find baked points.
-	while (start < idx) {
-		real_t offset = baked_dist_cache[idx];
-		if (p_offset <= offset) {
-			end = idx;
-		} else {
-			start = idx;
-		}
-		idx = (end + start) / 2;
+	// Jump to the first interval that can contain the offset, then walk forward.
+	// Baked points are (almost) evenly spaced, so this rarely takes more than a step.
+	const real_t *dists = baked_dist_cache.ptr();
+	int bucket = CLAMP(int(p_offset * baked_dist_lookup_scale), 0, baked_dist_lookup.size() - 1);
+	int idx = baked_dist_lookup[bucket];
+	while (idx < pc - 2 && dists[idx + 1] < p_offset) {
+		idx++;
 	}
 
-	real_t offset_begin = baked_dist_cache[idx];
-	real_t offset_end = baked_dist_cache[idx + 1];
+	real_t offset_begin = dists[idx];
+	real_t offset_end = dists[idx + 1];
 
 	real_t idx_interval = offset_end - offset_begin;
 	ERR_FAIL_COND_V_MSG(p_offset < offset_begin || p_offset > offset_end, interval, "Offset out of range.");
@@ -2059,6 +2125,45 @@ Transform3D Curve3D::sample_baked_with_rotation(real_t p_offset, bool p_cubic, b
 	return Transform3D(frame, pos);
 }
 
+TypedArray<Transform3D> Curve3D::sample_baked_with_rotation_batch(const PackedFloat32Array &p_offsets, bool p_cubic, bool p_apply_tilt) const {
+	TypedArray<Transform3D> transforms;
+
+	if (baked_cache_dirty) {
+		_bake();
+	}
+
+	// Every element matches what sample_baked_with_rotation() returns for the same offset,
+	// so failed samples are left as identity transforms instead of being dropped.
+	const int offset_count = p_offsets.size();
+	const float *offsets = p_offsets.ptr();
+	transforms.resize(offset_count);
+
+	// Validate: Curve may not have baked points.
+	const int point_count = baked_point_cache.size();
+	ERR_FAIL_COND_V_MSG(point_count == 0, transforms, "No points in Curve3D.");
+
+	if (point_count == 1) {
+		Transform3D t;
+		t.origin = baked_point_cache.get(0);
+		for (int i = 0; i < offset_count; i++) {
+			if (Math::is_finite(offsets[i])) {
+				transforms[i] = t;
+			}
+		}
+		ERR_FAIL_V_MSG(transforms, "Only 1 point in Curve3D.");
+	}
+
+	for (int i = 0; i < offset_count; i++) {
+		ERR_CONTINUE_MSG(!Math::is_finite(offsets[i]), "Offset is non-finite");
+
+		const real_t offset = CLAMP((real_t)offsets[i], 0.0, baked_max_ofs);
+		Curve3D::Interval interval = _find_interval(offset);
+		transforms[i] = Transform3D(_sample_posture(interval, p_apply_tilt), _sample_baked(interval, p_cubic));
+	}
+
+	return transforms;
+}
+
 real_t Curve3D::sample_baked_tilt(real_t p_offset) const {
 	// Make sure that p_offset is finite.
 	ERR_FAIL_COND_V_MSG(!Math::is_finite(p_offset), 0, "Offset is non-finite");
@@ -2491,6 +2596,7 @@ void Curve3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_baked_length"), &Curve3D::get_baked_length);
 	ClassDB::bind_method(D_METHOD("sample_baked", "offset", "cubic"), &Curve3D::sample_baked, DEFVAL(0.0), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("sample_baked_with_rotation", "offset", "cubic", "apply_tilt"), &Curve3D::sample_baked_with_rotation, DEFVAL(0.0), DEFVAL(false), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("sample_baked_with_rotation_batch", "offsets", "cubic", "apply_tilt"), &Curve3D::sample_baked_with_rotation_batch, DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("sample_baked_up_vector", "offset", "apply_tilt"), &Curve3D::sample_baked_up_vector, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_baked_points"), &Curve3D::get_baked_points);
 	ClassDB::bind_method(D_METHOD("get_baked_tilts"), &Curve3D::get_baked_tilts);
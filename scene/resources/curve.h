@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/variant/typed_array.h"
 
 // y(x) curve
 class Curve : public Resource {
@@ -188,6 +189,8 @@ class Curve2D : public Resource {
 	mutable PackedVector2Array baked_point_cache;
 	mutable PackedVector2Array baked_forward_vector_cache;
 	mutable Vector<real_t> baked_dist_cache;
+	mutable Vector<int32_t> baked_dist_lookup; // First interval reaching each evenly sized length bucket.
+	mutable real_t baked_dist_lookup_scale = 0.0;
 	mutable real_t baked_max_ofs = 0.0;
 
 	void mark_dirty();
@@ -244,6 +247,7 @@ public:
 	real_t get_baked_length() const;
 	Vector2 sample_baked(real_t p_offset, bool p_cubic = false) const;
 	Transform2D sample_baked_with_rotation(real_t p_offset, bool p_cubic = false) const;
+	TypedArray<Transform2D> sample_baked_with_rotation_batch(const PackedFloat32Array &p_offsets, bool p_cubic = false) const;
 	PackedVector2Array get_points() const;
 	PackedVector2Array get_baked_points() const; //useful for going through
 	Vector2 get_closest_point(const Vector2 &p_to_point) const;
@@ -277,6 +281,8 @@ class Curve3D : public Resource {
 	mutable PackedVector3Array baked_up_vector_cache;
 	mutable PackedVector3Array baked_forward_vector_cache;
 	mutable Vector<real_t> baked_dist_cache;
+	mutable Vector<int32_t> baked_dist_lookup; // First interval reaching each evenly sized length bucket.
+	mutable real_t baked_dist_lookup_scale = 0.0;
 	mutable real_t baked_max_ofs = 0.0;
 
 	void mark_dirty();
@@ -347,6 +353,7 @@ public:
 	real_t get_baked_length() const;
 	Vector3 sample_baked(real_t p_offset, bool p_cubic = false) const;
 	Transform3D sample_baked_with_rotation(real_t p_offset, bool p_cubic = false, bool p_apply_tilt = false) const;
+	TypedArray<Transform3D> sample_baked_with_rotation_batch(const PackedFloat32Array &p_offsets, bool p_cubic = false, bool p_apply_tilt = false) const;
 	real_t sample_baked_tilt(real_t p_offset) const;
 	Vector3 sample_baked_up_vector(real_t p_offset, bool p_apply_tilt = false) const;
 	PackedVector3Array get_baked_points() const; // Useful for going through.
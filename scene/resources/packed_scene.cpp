@@ -124,6 +124,44 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+void SceneState::_update_instantiation_plan() const {
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_ready.is_set()) {
+		return;
+	}
+
+	instantiation_setters.clear();
+	instantiation_setters.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= names.size()) {
+			// The class is not known until the node exists.
+			continue;
+		}
+
+		const StringName &type = names[n.type];
+		ClassDB::APIType api = ClassDB::get_api_type(type);
+		if (api != ClassDB::API_CORE && api != ClassDB::API_EDITOR) {
+			// Extension binds can go away on reload.
+			continue;
+		}
+
+		LocalVector<MethodBind *> &setters = instantiation_setters[i];
+		setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			const int name_idx = n.properties[j].name;
+			if ((name_idx & FLAG_PATH_PROPERTY_IS_NODE) || name_idx < 0 || name_idx >= names.size() || names[name_idx] == CoreStringName(script)) {
+				setters[j] = nullptr;
+				continue;
+			}
+			setters[j] = ClassDB::get_property_setter_method(type, names[name_idx]);
+		}
+	}
+
+	instantiation_plan_ready.set();
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -165,6 +203,13 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// Only plain runtime instantiation may bypass Object::set(), the editor relies on its side effects
+	// (such as marking the object as edited in TOOLS builds), even when instancing with edit state disabled.
+	const bool use_plan = p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint();
+	if (use_plan && !instantiation_plan_ready.is_set()) {
+		_update_instantiation_plan();
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
 
@@ -305,6 +350,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
 
+				// The planned setters only apply if the node is of the class the plan was made for.
+				MethodBind *const *nsetters = nullptr;
+				if (use_plan && !instantiation_setters[i].is_empty() && node->get_class_name() == snames[n.type] && !node->_get_extension()) {
+					nsetters = instantiation_setters[i].ptr();
+				}
+
 				Dictionary missing_resource_properties;
 				HashMap<Ref<Resource>, Ref<Resource>> resources_local_to_sub_scene; // Record the mappings in the sub-scene.
 
@@ -414,7 +465,13 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (nsetters && nsetters[j] && !node->get_script_instance()) {
+								const Variant *args[1] = { &value };
+								Callable::CallError ce;
+								nsetters[j]->call(node, args, 1, ce);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -1317,6 +1374,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1523,6 +1581,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	const Vector<int> sconns = p_dictionary["conns"];
 	ERR_FAIL_COND(sconns.size() < conn_count);
 
+	_clear_instantiation_plan();
+
 	Vector<String> snames = p_dictionary["names"];
 	if (snames.size()) {
 		int namecount = snames.size();
@@ -2003,6 +2063,7 @@ int SceneState::add_node_path(const NodePath &p_path) {
 }
 
 int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int p_instance, int p_index) {
+	_clear_instantiation_plan();
 	NodeData nd;
 	nd.parent = p_parent;
 	nd.owner = p_owner;
@@ -2017,6 +2078,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 }
 
 void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_deferred_node_path) {
+	_clear_instantiation_plan();
 	ERR_FAIL_INDEX(p_node, nodes.size());
 	ERR_FAIL_INDEX(p_name, names.size());
 	ERR_FAIL_INDEX(p_value, variants.size());
@@ -2088,6 +2150,9 @@ bool SceneState::rename_group_references(const StringName &p_old_name, const Str
 			}
 		}
 	}
+	if (edited) {
+		_clear_instantiation_plan();
+	}
 	return edited;
 }
 
@@ -2215,6 +2280,26 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+TypedArray<Node> PackedScene::instantiate_batch(int p_count, GenEditState p_edit_state) const {
+	ERR_FAIL_COND_V_MSG(p_count < 0, TypedArray<Node>(), "The number of instances can't be negative.");
+
+	TypedArray<Node> ret;
+	ret.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		Node *node = instantiate(p_edit_state);
+		if (!node) {
+			// Whatever failed will fail for the remaining instances too.
+			for (int j = 0; j < i; j++) {
+				memdelete(Object::cast_to<Node>(ret[j]));
+			}
+			ERR_FAIL_V_MSG(TypedArray<Node>(), vformat("Failed to instantiate scene \"%s\".", get_path()));
+		}
+		ret[i] = node;
+	}
+
+	return ret;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
 	state = p_by;
 	state->set_path(get_path());
@@ -2301,6 +2386,7 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_batch", "count", "edit_state"), &PackedScene::instantiate_batch, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -88,6 +89,15 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Setter binds resolved once per node property, used to skip the property lookups of Object::set()
+	// when instantiating at runtime. Null entries fall back to Object::set().
+	mutable LocalVector<LocalVector<MethodBind *>> instantiation_setters;
+	mutable SafeFlag instantiation_plan_ready;
+	mutable Mutex instantiation_plan_mutex;
+
+	void _update_instantiation_plan() const;
+	_FORCE_INLINE_ void _clear_instantiation_plan() { instantiation_plan_ready.clear(); }
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -257,6 +267,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	TypedArray<Node> instantiate_batch(int p_count, GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
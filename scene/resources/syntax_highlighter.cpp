@@ -50,17 +50,42 @@ Dictionary SyntaxHighlighter::get_line_syntax_highlighting(int p_line) {
 	return color_map;
 }
 
+void SyntaxHighlighter::_erase_highlighting_cache_from(int p_line) {
+	RBMap<int, Dictionary>::Element *E = highlighting_cache.back();
+	while (E && E->key() >= p_line) {
+		RBMap<int, Dictionary>::Element *prev = E->prev();
+		highlighting_cache.erase(E);
+		E = prev;
+	}
+}
+
 void SyntaxHighlighter::_lines_edited_from(int p_from_line, int p_to_line) {
 	if (highlighting_cache.size() < 1) {
 		return;
 	}
 
-	int cache_size = highlighting_cache.back()->key();
-	for (int i = MIN(p_from_line, p_to_line) - 1; i <= cache_size; i++) {
-		if (highlighting_cache.has(i)) {
-			highlighting_cache.erase(i);
+	const int first_line = MIN(p_from_line, p_to_line) - 1;
+
+	// An edit within a single line keeps the line count, so the lines below stay valid
+	// as long as the state carried out of the edited line doesn't change.
+	if (p_from_line == p_to_line && text_edit != nullptr && !GDVIRTUAL_IS_OVERRIDDEN(_get_line_syntax_highlighting)) {
+		int old_state = 0;
+		const bool had_state = highlighting_cache.has(p_to_line) && _get_line_end_state(p_to_line, old_state);
+
+		highlighting_cache.erase(first_line);
+		highlighting_cache.erase(p_to_line);
+
+		if (had_state) {
+			get_line_syntax_highlighting(p_to_line);
+
+			int new_state = 0;
+			if (_get_line_end_state(p_to_line, new_state) && new_state == old_state) {
+				return;
+			}
 		}
 	}
+
+	_erase_highlighting_cache_from(first_line);
 }
 
 void SyntaxHighlighter::clear_highlighting_cache() {
@@ -413,6 +438,15 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 	return color_map;
 }
 
+bool CodeHighlighter::_get_line_end_state(int p_line, int &r_state) const {
+	const int *region = color_region_cache.getptr(p_line);
+	if (region == nullptr) {
+		return false;
+	}
+	r_state = *region;
+	return true;
+}
+
 void CodeHighlighter::_clear_highlighting_cache() {
 	color_region_cache.clear();
 }
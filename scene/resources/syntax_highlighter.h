@@ -40,6 +40,7 @@ class SyntaxHighlighter : public Resource {
 
 private:
 	RBMap<int, Dictionary> highlighting_cache;
+	void _erase_highlighting_cache_from(int p_line);
 	void _lines_edited_from(int p_from_line, int p_to_line);
 
 protected:
@@ -55,6 +56,10 @@ public:
 	Dictionary get_line_syntax_highlighting(int p_line);
 	virtual Dictionary _get_line_syntax_highlighting_impl(int p_line) { return Dictionary(); }
 
+	// Highlighters that carry state across lines (e.g. open multiline strings) report it here,
+	// so edits that don't change the state at the end of a line keep the cache below it.
+	virtual bool _get_line_end_state(int p_line, int &r_state) const { return false; }
+
 	void clear_highlighting_cache();
 	virtual void _clear_highlighting_cache() {}
 
@@ -98,6 +103,7 @@ protected:
 
 public:
 	virtual Dictionary _get_line_syntax_highlighting_impl(int p_line) override;
+	virtual bool _get_line_end_state(int p_line, int &r_state) const override;
 
 	virtual void _clear_highlighting_cache() override;
 	virtual void _update_cache() override;
@@ -455,6 +455,149 @@ TEST_CASE("[Object] Signals") {
 	}
 }
 
+class _SignalCounter : public Object {
+public:
+	Object *emitter = nullptr;
+	Callable disconnect_callable;
+	int calls = 0;
+
+	void count() {
+		calls++;
+	}
+
+	void count_and_disconnect() {
+		calls++;
+		emitter->disconnect("my_custom_signal", disconnect_callable);
+	}
+
+	void count_and_free() {
+		calls++;
+		memdelete(to_free);
+		to_free = nullptr;
+	}
+
+	void add(int p_value, int p_bound) {
+		calls++;
+		sum += p_value + p_bound;
+	}
+
+	Object *to_free = nullptr;
+	int sum = 0;
+};
+
+// Holds a reference like a script lambda capturing a local variable.
+class _CapturingCallable : public CallableCustom {
+	static bool _compare_equal(const CallableCustom *p_a, const CallableCustom *p_b) { return p_a == p_b; }
+	static bool _compare_less(const CallableCustom *p_a, const CallableCustom *p_b) { return p_a < p_b; }
+
+public:
+	ObjectID target;
+	Ref<RefCounted> capture;
+
+	uint32_t hash() const override { return hash_murmur3_one_64((uint64_t)this); }
+	String get_as_text() const override { return "_CapturingCallable"; }
+	CompareEqualFunc get_compare_equal_func() const override { return _compare_equal; }
+	CompareLessFunc get_compare_less_func() const override { return _compare_less; }
+	ObjectID get_object() const override { return target; }
+	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const override {
+		r_call_error.error = Callable::CallError::CALL_OK;
+	}
+};
+
+TEST_CASE("[Object] Signal dispatch") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	Object object;
+	object.add_user_signal(MethodInfo("my_custom_signal", PropertyInfo(Variant::INT, "value")));
+
+	SUBCASE("Native methods are called directly when the target has no script") {
+		_TestDerivedObject target;
+		target.set_property(0);
+		object.connect("my_custom_signal", Callable(&target, "set_property"));
+
+		CHECK(object.emit_signal("my_custom_signal", 5) == OK);
+		CHECK_EQ(target.get_property(), 5);
+
+		// Once a script instance is attached, it must take precedence over the native method.
+		target.set_script_instance(memnew(_MockScriptInstance));
+		CHECK(object.emit_signal("my_custom_signal", 7) == OK);
+		CHECK_EQ(target.get_property(), 5);
+	}
+
+	SUBCASE("Disconnecting during emission does not affect the current emission") {
+		_SignalCounter first;
+		_SignalCounter second;
+		first.emitter = &object;
+		first.disconnect_callable = callable_mp(&second, &_SignalCounter::count);
+		object.connect("my_custom_signal", callable_mp(&first, &_SignalCounter::count_and_disconnect).unbind(1));
+		object.connect("my_custom_signal", first.disconnect_callable.unbind(1));
+
+		object.emit_signal("my_custom_signal", 0);
+		CHECK_EQ(first.calls, 1);
+		CHECK_EQ(second.calls, 1);
+
+		ERR_PRINT_OFF;
+		object.emit_signal("my_custom_signal", 0);
+		ERR_PRINT_ON;
+		CHECK_EQ(first.calls, 2);
+		CHECK_EQ(second.calls, 1);
+	}
+
+	SUBCASE("Bound arguments are appended to the emitted ones") {
+		_SignalCounter counter;
+		object.connect("my_custom_signal", callable_mp(&counter, &_SignalCounter::add).bind(10));
+
+		object.emit_signal("my_custom_signal", 5);
+		object.emit_signal("my_custom_signal", 7);
+		CHECK_EQ(counter.calls, 2);
+		CHECK_EQ(counter.sum, 32);
+	}
+
+	SUBCASE("Targets freed during emission are skipped") {
+		_SignalCounter first;
+		_TestDerivedObject *target = memnew(_TestDerivedObject);
+		first.to_free = target;
+		object.connect("my_custom_signal", callable_mp(&first, &_SignalCounter::count_and_free).unbind(1));
+		const Callable target_callable(target, "set_property");
+		object.connect("my_custom_signal", target_callable);
+
+		// The emission still holds the freed target in its dispatch list, and must not call into it.
+		CHECK(object.emit_signal("my_custom_signal", 3) == OK);
+		CHECK_EQ(first.calls, 1);
+		CHECK_FALSE(object.is_connected("my_custom_signal", target_callable));
+	}
+
+	SUBCASE("One-shot connections are only called once") {
+		_SignalCounter counter;
+		object.connect("my_custom_signal", callable_mp(&counter, &_SignalCounter::count).unbind(1), Object::CONNECT_ONE_SHOT);
+
+		object.emit_signal("my_custom_signal", 0);
+		object.emit_signal("my_custom_signal", 0);
+		CHECK_EQ(counter.calls, 1);
+		CHECK_FALSE(object.has_connections("my_custom_signal"));
+	}
+
+	SUBCASE("Disconnecting releases references held by the callable") {
+		Object target;
+		Ref<RefCounted> captured;
+		captured.instantiate();
+		const ObjectID captured_id = captured->get_instance_id();
+
+		_CapturingCallable *lambda_custom = memnew(_CapturingCallable);
+		lambda_custom->target = target.get_instance_id();
+		lambda_custom->capture = captured;
+		Callable lambda(lambda_custom);
+		captured.unref();
+
+		object.connect("my_custom_signal", lambda);
+		object.emit_signal("my_custom_signal", 0);
+		object.disconnect("my_custom_signal", lambda);
+		lambda = Callable();
+
+		// No further emission is needed for the capture to be freed.
+		CHECK(ObjectDB::get_instance(captured_id) == nullptr);
+	}
+}
+
 class NotificationObjectSuperclass : public Object {
 	GDCLASS(NotificationObjectSuperclass, Object);
 
@@ -2245,4 +2245,37 @@ TEST_CASE("[Variant] Operator NOT") {
 	}
 }
 
+TEST_CASE("[Variant] Packed float array math methods") {
+	Variant a = PackedFloat32Array({ 1.0, -2.0, 3.0, 0.5 });
+	Variant b = PackedFloat32Array({ 1.0, 2.0, 1.0, 2.0 });
+
+	CHECK_EQ(a.call("add", b), Variant(PackedFloat32Array({ 2.0, 0.0, 4.0, 2.5 })));
+	CHECK_EQ(a.call("multiply", b), Variant(PackedFloat32Array({ 1.0, -4.0, 3.0, 1.0 })));
+	CHECK_EQ(a.call("lerp", b, 0.5), Variant(PackedFloat32Array({ 1.0, 0.0, 2.0, 1.25 })));
+	CHECK_EQ(a.call("clamp", 0.0, 2.0), Variant(PackedFloat32Array({ 1.0, 0.0, 2.0, 0.5 })));
+
+	CHECK_EQ(a.call("sum"), Variant(2.5));
+	CHECK_EQ(a.call("min"), Variant(-2.0));
+	CHECK_EQ(a.call("max"), Variant(3.0));
+	CHECK_EQ(a.call("argmin"), Variant(1));
+	CHECK_EQ(a.call("argmax"), Variant(2));
+
+	Variant empty = PackedFloat64Array();
+	CHECK_EQ(empty.call("sum"), Variant(0.0));
+	CHECK_EQ(empty.call("argmax"), Variant(-1));
+
+	ERR_PRINT_OFF;
+	Variant mismatched = a.call("add", PackedFloat32Array({ 1.0 }));
+	ERR_PRINT_ON;
+	CHECK_EQ(mismatched, Variant(PackedFloat32Array()));
+}
+
+TEST_CASE("[Variant] PackedVector3Array math methods") {
+	Variant a = PackedVector3Array({ Vector3(3, 4, 0), Vector3(1, 2, 2) });
+	Variant b = PackedVector3Array({ Vector3(1, 0, 0), Vector3(1, 1, 1) });
+
+	CHECK_EQ(a.call("dot", b), Variant(PackedFloat32Array({ 3.0, 5.0 })));
+	CHECK_EQ(a.call("lengths"), Variant(PackedFloat32Array({ 5.0, 3.0 })));
+}
+
 } // namespace TestVariant
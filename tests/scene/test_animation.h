@@ -308,4 +308,33 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Compressed 3D position track") {
+	Ref<Animation> animation = memnew(Animation);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track_index, NodePath("Enemy:position"));
+	animation->set_length(10.0);
+	for (int i = 0; i <= 100; i++) {
+		animation->position_track_insert_key(track_index, i * 0.1, Vector3(i, Math::sin(i * 0.1) * 10.0, -i * 0.5));
+	}
+
+	Vector<double> times;
+	Vector<Vector3> expected;
+	for (double time = 0.0; time <= 10.0; time += 0.37) {
+		Vector3 r_interpolation;
+		CHECK(animation->try_position_track_interpolate(track_index, time, &r_interpolation) == OK);
+		times.push_back(time);
+		expected.push_back(r_interpolation);
+	}
+
+	// Use small pages so sampling has to pick among several of them.
+	animation->compress(512);
+	CHECK(animation->track_is_compressed(track_index));
+
+	for (int i = 0; i < times.size(); i++) {
+		Vector3 r_interpolation;
+		CHECK(animation->try_position_track_interpolate(track_index, times[i], &r_interpolation) == OK);
+		CHECK(r_interpolation.distance_to(expected[i]) < 0.05);
+	}
+}
+
 } // namespace TestAnimation
@@ -61,4 +61,24 @@ TEST_CASE("[SceneTree][Button] is_hovered()") {
 	memdelete(button);
 }
 
+TEST_CASE("[SceneTree][Button] Minimum size follows text changed while hidden") {
+	Button *button = memnew(Button);
+	Window *root = SceneTree::get_singleton()->get_root();
+	root->add_child(button);
+
+	button->set_text("A");
+	const Size2 short_size = button->get_minimum_size();
+
+	// Text is only shaped once it is needed, which must still happen for hidden buttons.
+	button->hide();
+	button->set_text("A much longer button text");
+	CHECK(button->get_minimum_size().width > short_size.width);
+
+	button->set_text("A");
+	button->show();
+	CHECK(button->get_minimum_size() == short_size);
+
+	memdelete(button);
+}
+
 } //namespace TestButton
@@ -5704,4 +5704,50 @@ func _ready():
 	memdelete(code_edit);
 }
 
+class TestCountingHighlighter : public CodeHighlighter {
+public:
+	HashMap<int, int> highlight_count;
+
+	virtual Dictionary _get_line_syntax_highlighting_impl(int p_line) override {
+		highlight_count[p_line] = highlight_count.has(p_line) ? highlight_count[p_line] + 1 : 1;
+		return CodeHighlighter::_get_line_syntax_highlighting_impl(p_line);
+	}
+};
+
+TEST_CASE("[SceneTree][CodeEdit] highlighting cache after single line edits") {
+	CodeEdit *code_edit = memnew(CodeEdit);
+	SceneTree::get_singleton()->get_root()->add_child(code_edit);
+
+	Ref<TestCountingHighlighter> highlighter;
+	highlighter.instantiate();
+	const Color region_color = Color(1, 0, 0);
+	highlighter->add_color_region("/*", "*/", region_color);
+	code_edit->set_syntax_highlighter(highlighter);
+
+	code_edit->set_text("var a = 1\nvar b = 2\nvar c = 3\nvar d = 4");
+	for (int i = 0; i < code_edit->get_line_count(); i++) {
+		highlighter->get_line_syntax_highlighting(i);
+	}
+	const int line_3_count = highlighter->highlight_count[3];
+
+	SUBCASE("Edit outside of a region keeps the lines below") {
+		code_edit->set_line(1, "var b = 22");
+		highlighter->get_line_syntax_highlighting(1);
+		highlighter->get_line_syntax_highlighting(3);
+		CHECK(highlighter->highlight_count[3] == line_3_count);
+		CHECK_FALSE(Dictionary(highlighter->get_line_syntax_highlighting(3)[0]).get("color", Color()) == Variant(region_color));
+	}
+
+	SUBCASE("Opening a region rehighlights the lines below") {
+		code_edit->set_line(1, "var b = 2 /*");
+		highlighter->get_line_syntax_highlighting(1);
+		highlighter->get_line_syntax_highlighting(2);
+		highlighter->get_line_syntax_highlighting(3);
+		CHECK(highlighter->highlight_count[3] > line_3_count);
+		CHECK(Dictionary(highlighter->get_line_syntax_highlighting(3)[0]).get("color", Color()) == Variant(region_color));
+	}
+
+	memdelete(code_edit);
+}
+
 } // namespace TestCodeEdit
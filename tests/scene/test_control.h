@@ -31,6 +31,7 @@
 #pragma once
 
 #include "scene/2d/node_2d.h"
+#include "scene/gui/box_container.h"
 #include "scene/gui/control.h"
 
 #include "tests/test_macros.h"
@@ -1128,6 +1129,32 @@ TEST_CASE("[SceneTree][Control] Custom minimum size") {
 	memdelete(test_control);
 }
 
+TEST_CASE("[SceneTree][Control] Nested containers are sorted once per change") {
+	VBoxContainer *outer = memnew(VBoxContainer);
+	VBoxContainer *inner = memnew(VBoxContainer);
+	Control *child = memnew(Control);
+	child->set_custom_minimum_size(Size2(10, 10));
+	inner->add_child(child);
+	outer->add_child(inner);
+	SceneTree::get_singleton()->get_root()->add_child(outer);
+	MessageQueue::get_singleton()->flush();
+	CHECK(inner->get_size().is_equal_approx(Size2(10, 10)));
+
+	SIGNAL_WATCH(inner, SceneStringName(sort_children));
+	child->set_custom_minimum_size(Size2(20, 40));
+	MessageQueue::get_singleton()->flush();
+
+	// The inner container is only sorted after the outer one gave it its final size.
+	Array signal_args = { {} };
+	SIGNAL_CHECK(SceneStringName(sort_children), signal_args);
+	CHECK(outer->get_size().is_equal_approx(Size2(20, 40)));
+	CHECK(inner->get_size().is_equal_approx(Size2(20, 40)));
+	CHECK(child->get_size().is_equal_approx(Size2(20, 40)));
+	SIGNAL_UNWATCH(inner, SceneStringName(sort_children));
+
+	memdelete(outer);
+}
+
 TEST_CASE("[SceneTree][Control] Grow direction") {
 	Control *test_control = memnew(Control);
 	test_control->set_size(Size2(1, 1));
@@ -249,6 +249,45 @@ TEST_CASE("[Curve2D] Sampling") {
 		CHECK(cross_linear_curve->get_baked_points().size() >= 3);
 		CHECK(cross_linear_curve->sample_baked_with_rotation(cross_linear_curve->get_closest_offset(Vector2(0.5, 0))).is_equal_approx(Transform2D(Vector2(1, 0), Vector2(0, 1), Vector2(0.5, 0))));
 	}
+
+	SUBCASE("sample_baked_with_rotation_batch, segments of different lengths") {
+		Ref<Curve2D> bent_curve = memnew(Curve2D);
+		bent_curve->add_point(Vector2());
+		bent_curve->add_point(Vector2(0, 1));
+		bent_curve->add_point(Vector2(30, 1));
+		CHECK(bent_curve->get_baked_length() == doctest::Approx(31));
+
+		PackedFloat32Array offsets = { 0, 0.5, 16, 31, 40, -5 };
+		TypedArray<Transform2D> transforms = bent_curve->sample_baked_with_rotation_batch(offsets, true);
+		REQUIRE(transforms.size() == offsets.size());
+		for (int i = 0; i < offsets.size(); i++) {
+			CHECK(Transform2D(transforms[i]).is_equal_approx(bent_curve->sample_baked_with_rotation(offsets[i], true)));
+		}
+	}
+
+	SUBCASE("sample_baked_with_rotation_batch, invalid input matches sample_baked_with_rotation") {
+		PackedFloat32Array offsets = { 10, (float)Math::NaN, (float)Math::INF };
+		ERR_PRINT_OFF;
+		TypedArray<Transform2D> transforms = curve->sample_baked_with_rotation_batch(offsets);
+		REQUIRE(transforms.size() == offsets.size());
+		for (int i = 0; i < offsets.size(); i++) {
+			CHECK(Transform2D(transforms[i]).is_equal_approx(curve->sample_baked_with_rotation(offsets[i])));
+		}
+		CHECK(Transform2D(transforms[1]) == Transform2D());
+
+		Ref<Curve2D> single_point_curve = memnew(Curve2D);
+		single_point_curve->add_point(Vector2(3, 4));
+		transforms = single_point_curve->sample_baked_with_rotation_batch(offsets);
+		REQUIRE(transforms.size() == offsets.size());
+		for (int i = 0; i < offsets.size(); i++) {
+			CHECK(Transform2D(transforms[i]).is_equal_approx(single_point_curve->sample_baked_with_rotation(offsets[i])));
+		}
+		CHECK(Transform2D(transforms[0]).get_origin() == Vector2(3, 4));
+
+		Ref<Curve2D> empty_curve = memnew(Curve2D);
+		CHECK(empty_curve->sample_baked_with_rotation_batch(offsets).size() == offsets.size());
+		ERR_PRINT_ON;
+	}
 }
 
 TEST_CASE("[Curve2D] Tessellation") {
@@ -246,6 +246,25 @@ TEST_CASE("[Curve3D] Sampling") {
 		CHECK(cross_linear_curve->get_baked_points().size() >= 3);
 		CHECK(cross_linear_curve->sample_baked_with_rotation(cross_linear_curve->get_closest_offset(Vector3(0.5, 0, 0))).is_equal_approx(Transform3D(Basis(Vector3(0, 0, 1), Vector3(0, 1, 0), Vector3(-1, 0, 0)), Vector3(0.5, 0, 0))));
 	}
+
+	SUBCASE("sample_baked and sample_baked_with_rotation_batch, segments of different lengths") {
+		Ref<Curve3D> bent_curve = memnew(Curve3D);
+		bent_curve->add_point(Vector3());
+		bent_curve->add_point(Vector3(0, 1, 0));
+		bent_curve->add_point(Vector3(0, 1, 30));
+		CHECK(bent_curve->get_baked_length() == doctest::Approx(31));
+		CHECK(bent_curve->sample_baked(0.5).is_equal_approx(Vector3(0, 0.5, 0)));
+		CHECK(bent_curve->sample_baked(1).is_equal_approx(Vector3(0, 1, 0)));
+		CHECK(bent_curve->sample_baked(16).is_equal_approx(Vector3(0, 1, 15)));
+		CHECK(bent_curve->sample_baked(31).is_equal_approx(Vector3(0, 1, 30)));
+
+		PackedFloat32Array offsets = { 0, 0.5, 16, 31, 40 };
+		TypedArray<Transform3D> transforms = bent_curve->sample_baked_with_rotation_batch(offsets, false, true);
+		REQUIRE(transforms.size() == offsets.size());
+		for (int i = 0; i < offsets.size(); i++) {
+			CHECK(Transform3D(transforms[i]).is_equal_approx(bent_curve->sample_baked_with_rotation(offsets[i], false, true)));
+		}
+	}
 }
 
 TEST_CASE("[Curve3D] Tessellation") {
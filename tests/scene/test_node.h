@@ -31,6 +31,11 @@
 #pragma once
 
 #include "core/object/class_db.h"
+#include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/3d/node_3d.h"
 #include "scene/main/node.h"
 #include "scene/resources/packed_scene.h"
 
@@ -54,6 +59,11 @@ protected:
 			} break;
 			case NOTIFICATION_PROCESS: {
 				process_counter++;
+				process_begin_usec = OS::get_singleton()->get_ticks_usec();
+				if (process_delay_usec > 0) {
+					OS::get_singleton()->delay_usec(process_delay_usec);
+				}
+				process_end_usec = OS::get_singleton()->get_ticks_usec();
 				push_self();
 			} break;
 			case NOTIFICATION_PHYSICS_PROCESS: {
@@ -85,6 +95,9 @@ public:
 	int internal_physics_process_counter = 0;
 	int process_counter = 0;
 	int physics_process_counter = 0;
+	uint32_t process_delay_usec = 0;
+	uint64_t process_begin_usec = 0;
+	uint64_t process_end_usec = 0;
 
 	Node *exported_node = nullptr;
 	Array exported_nodes;
@@ -105,6 +118,42 @@ public:
 	}
 };
 
+class TestTransformNode2D : public Node2D {
+	GDCLASS(TestTransformNode2D, Node2D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_counter++;
+		}
+	}
+
+public:
+	int transform_changed_counter = 0;
+
+	TestTransformNode2D() {
+		set_notify_transform(true);
+	}
+};
+
+class TestTransformNode3D : public Node3D {
+	GDCLASS(TestTransformNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_counter++;
+		}
+	}
+
+public:
+	int transform_changed_counter = 0;
+
+	TestTransformNode3D() {
+		set_notify_transform(true);
+	}
+};
+
 TEST_CASE("[SceneTree][Node] Testing node operations with a very simple scene tree") {
 	Node *node = memnew(Node);
 
@@ -845,6 +894,327 @@ TEST_CASE("[SceneTree][Node] Test the processing") {
 	memdelete(node);
 }
 
+TEST_CASE("[SceneTree][Node] Process group profile") {
+	TestNode *first = memnew(TestNode);
+	first->set_process_thread_group(Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+	first->set_process_thread_group_order(-2);
+	first->set_process(true);
+
+	TestNode *node = memnew(TestNode);
+	node->set_process_thread_group(Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+	node->set_process_thread_group_order(3);
+	node->set_process(true);
+	node->process_delay_usec = 2000;
+
+	// Add in reverse order, so the profile has to follow the sorted groups.
+	SceneTree::get_singleton()->get_root()->add_child(node);
+	SceneTree::get_singleton()->get_root()->add_child(first);
+
+	SceneTree::get_singleton()->process(0);
+	CHECK_EQ(1, first->process_counter);
+	CHECK_EQ(1, node->process_counter);
+
+	TypedArray<Dictionary> profile = SceneTree::get_singleton()->get_process_group_profile();
+	int first_index = -1;
+	int node_index = -1;
+	for (int i = 0; i < profile.size(); i++) {
+		Dictionary d = profile[i];
+		CHECK(d.has("owner"));
+		CHECK(d.has("order"));
+		CHECK(d.has("threaded"));
+		CHECK(d.has("node_count"));
+		CHECK(d.has("physics_node_count"));
+		CHECK(d.has("process_usec"));
+		CHECK(d.has("physics_process_usec"));
+
+		Node *owner = Object::cast_to<Node>(d["owner"]);
+		if (owner == first) {
+			first_index = i;
+			CHECK_EQ(int(d["order"]), -2);
+		} else if (owner == node) {
+			node_index = i;
+			CHECK_EQ(int(d["order"]), 3);
+			CHECK_FALSE(bool(d["threaded"]));
+			CHECK_EQ(int(d["node_count"]), 1);
+			CHECK_EQ(int(d["physics_node_count"]), 0);
+			// The node sleeps for 2 ms while processing, which must show up in the group time.
+			CHECK(int64_t(d["process_usec"]) >= 2000);
+			CHECK_EQ(int64_t(d["physics_process_usec"]), 0);
+		}
+	}
+	REQUIRE(first_index >= 0);
+	REQUIRE(node_index >= 0);
+	CHECK(first_index < node_index);
+
+	memdelete(first);
+	memdelete(node);
+}
+
+TEST_CASE("[SceneTree][Node] Threaded process groups are dispatched by cost") {
+	SceneTree *tree = SceneTree::get_singleton();
+
+	// More cheap groups than worker threads, so some of them can only start after others finished.
+	const int cheap_count = WorkerThreadPool::get_singleton()->get_thread_count() * 2 + 1;
+	LocalVector<TestNode *> cheap;
+	for (int i = 0; i < cheap_count; i++) {
+		TestNode *node = memnew(TestNode);
+		node->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		node->set_process(true);
+		node->process_delay_usec = 2000;
+		tree->get_root()->add_child(node);
+		cheap.push_back(node);
+	}
+	// Added last, so only the cost ordering can move it ahead of the cheap groups.
+	TestNode *expensive = memnew(TestNode);
+	expensive->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	expensive->set_process(true);
+	expensive->process_delay_usec = 10000;
+	tree->get_root()->add_child(expensive);
+
+	// The first pass measures the groups, the second one is dispatched according to that.
+	tree->process(0);
+	tree->process(0);
+	REQUIRE_EQ(expensive->process_counter, 2);
+
+	uint64_t first_cheap_end = UINT64_MAX;
+	for (TestNode *node : cheap) {
+		CHECK_EQ(node->process_counter, 2);
+		first_cheap_end = MIN(first_cheap_end, node->process_end_usec);
+	}
+	CHECK(expensive->process_begin_usec <= first_cheap_end);
+
+	TypedArray<Dictionary> profile = tree->get_process_group_profile();
+	int found = 0;
+	for (int i = 0; i < profile.size(); i++) {
+		Dictionary d = profile[i];
+		Node *owner = Object::cast_to<Node>(d["owner"]);
+		if (owner == expensive) {
+			CHECK(int64_t(d["process_usec"]) >= 10000);
+		} else if (cheap.has(static_cast<TestNode *>(owner))) {
+			CHECK(int64_t(d["process_usec"]) >= 2000);
+		} else {
+			continue;
+		}
+		found++;
+		CHECK(bool(d["threaded"]));
+		CHECK_EQ(int(d["node_count"]), 1);
+	}
+	CHECK_EQ(found, cheap_count + 1);
+
+	// A group with nothing to process must not keep reporting an earlier pass.
+	expensive->set_process(false);
+	tree->process(0);
+	profile = tree->get_process_group_profile();
+	for (int i = 0; i < profile.size(); i++) {
+		Dictionary d = profile[i];
+		if (Object::cast_to<Node>(d["owner"]) == expensive) {
+			CHECK_EQ(int64_t(d["process_usec"]), 0);
+		}
+	}
+
+	for (TestNode *node : cheap) {
+		memdelete(node);
+	}
+	memdelete(expensive);
+}
+
+TEST_CASE("[SceneTree][Node] Group calls") {
+	SceneTree *tree = SceneTree::get_singleton();
+	LocalVector<Node *> nodes;
+	for (int i = 0; i < 16; i++) {
+		// Mix classes, so the cached method lookup is invalidated along the way.
+		Node *node = i % 3 == 0 ? memnew(TestNode) : memnew(Node);
+		tree->get_root()->add_child(node);
+		node->add_to_group("group_call_test");
+		nodes.push_back(node);
+	}
+
+	SUBCASE("Call on every node") {
+		tree->call_group("group_call_test", "set_process_priority", 7);
+		for (Node *node : nodes) {
+			CHECK_EQ(node->get_process_priority(), 7);
+		}
+	}
+
+	SUBCASE("Parallel call on every node") {
+		tree->call_group_flags(SceneTree::GROUP_CALL_PARALLEL, "group_call_test", "set_meta", "group_call", 3);
+		for (Node *node : nodes) {
+			CHECK_EQ(int(node->get_meta("group_call", 0)), 3);
+		}
+	}
+
+	SUBCASE("Parallel call passes the thread guard of the called node") {
+		nodes[0]->set_process(true);
+		tree->call_group_flags(SceneTree::GROUP_CALL_PARALLEL, "group_call_test", "set_process_priority", 5);
+		for (Node *node : nodes) {
+			CHECK_EQ(node->get_process_priority(), 5);
+		}
+	}
+
+	SUBCASE("Parallel and deferred can't be combined") {
+		ERR_PRINT_OFF;
+		tree->call_group_flags(SceneTree::GROUP_CALL_PARALLEL | SceneTree::GROUP_CALL_DEFERRED, "group_call_test", "set_meta", "group_call", 3);
+		ERR_PRINT_ON;
+		MessageQueue::get_singleton()->flush();
+		for (Node *node : nodes) {
+			CHECK_FALSE(node->has_meta("group_call"));
+		}
+	}
+
+	SUBCASE("Free nodes") {
+		tree->call_group("group_call_test", "free");
+		CHECK_EQ(tree->get_node_count_in_group("group_call_test"), 0);
+		nodes.clear();
+	}
+
+	for (Node *node : nodes) {
+		memdelete(node);
+	}
+}
+
+TEST_CASE("[SceneTree][Node] Parallel group calls on nodes notifying transform changes") {
+	GDREGISTER_CLASS(TestTransformNode2D);
+	GDREGISTER_CLASS(TestTransformNode3D);
+
+	SceneTree *tree = SceneTree::get_singleton();
+	LocalVector<TestTransformNode2D *> nodes_2d;
+	LocalVector<TestTransformNode3D *> nodes_3d;
+	for (int i = 0; i < 256; i++) {
+		TestTransformNode2D *node_2d = memnew(TestTransformNode2D);
+		tree->get_root()->add_child(node_2d);
+		node_2d->add_to_group("parallel_2d");
+		nodes_2d.push_back(node_2d);
+
+		TestTransformNode3D *node_3d = memnew(TestTransformNode3D);
+		tree->get_root()->add_child(node_3d);
+		node_3d->add_to_group("parallel_3d");
+		nodes_3d.push_back(node_3d);
+	}
+	tree->flush_transform_notifications();
+	for (uint32_t i = 0; i < nodes_2d.size(); i++) {
+		// Validate the global transforms, otherwise the change would not be propagated.
+		nodes_2d[i]->get_global_transform();
+		nodes_3d[i]->get_global_transform();
+		nodes_2d[i]->transform_changed_counter = 0;
+		nodes_3d[i]->transform_changed_counter = 0;
+	}
+
+	// Every call queues its node for a transform notification from a worker thread.
+	tree->call_group_flags(SceneTree::GROUP_CALL_PARALLEL, "parallel_2d", "set_position", Vector2(1, 2));
+	tree->call_group_flags(SceneTree::GROUP_CALL_PARALLEL, "parallel_3d", "set_position", Vector3(1, 2, 3));
+	tree->flush_transform_notifications();
+
+	for (uint32_t i = 0; i < nodes_2d.size(); i++) {
+		CHECK_EQ(nodes_2d[i]->get_position(), Vector2(1, 2));
+		CHECK_EQ(nodes_2d[i]->transform_changed_counter, 1);
+		CHECK_EQ(nodes_3d[i]->get_position(), Vector3(1, 2, 3));
+		CHECK_EQ(nodes_3d[i]->transform_changed_counter, 1);
+	}
+
+	// Nothing is left queued, or the list was corrupted.
+	tree->flush_transform_notifications();
+	for (uint32_t i = 0; i < nodes_2d.size(); i++) {
+		CHECK_EQ(nodes_2d[i]->transform_changed_counter, 1);
+		CHECK_EQ(nodes_3d[i]->transform_changed_counter, 1);
+		memdelete(nodes_2d[i]);
+		memdelete(nodes_3d[i]);
+	}
+}
+
+TEST_CASE("[SceneTree][Node] Cached get_node results follow tree changes") {
+	Node *parent = memnew(Node);
+	parent->set_name("Parent");
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	parent->add_child(child);
+
+	const NodePath path("Child");
+	CHECK_EQ(parent->get_node_or_null(path), child);
+	CHECK_EQ(parent->get_node_or_null(path), child);
+	CHECK_EQ(child->get_node_or_null(NodePath("..")), parent);
+	CHECK_EQ(parent->get_node_or_null(child->get_path()), child);
+
+	SUBCASE("Rename") {
+		child->set_name("Renamed");
+		CHECK_EQ(parent->get_node_or_null(path), nullptr);
+		CHECK_EQ(parent->get_node_or_null(NodePath("Renamed")), child);
+	}
+
+	SUBCASE("Remove and free") {
+		parent->remove_child(child);
+		CHECK_EQ(parent->get_node_or_null(path), nullptr);
+		CHECK_EQ(child->get_node_or_null(NodePath("..")), nullptr);
+		memdelete(child);
+
+		Node *other = memnew(Node);
+		other->set_name("Child");
+		parent->add_child(other);
+		CHECK_EQ(parent->get_node_or_null(path), other);
+	}
+
+	SUBCASE("Unique name") {
+		child->set_owner(parent);
+		child->set_unique_name_in_owner(true);
+		CHECK_EQ(parent->get_node_or_null(NodePath("%Child")), child);
+		child->set_unique_name_in_owner(false);
+		CHECK_EQ(parent->get_node_or_null(NodePath("%Child")), nullptr);
+	}
+
+	SUBCASE("Absolute paths follow ancestor changes") {
+		const NodePath absolute = child->get_path();
+		CHECK_EQ(parent->get_node_or_null(absolute), child);
+
+		Node *grandparent = memnew(Node);
+		SceneTree::get_singleton()->get_root()->add_child(grandparent);
+		parent->reparent(grandparent);
+		CHECK_EQ(parent->get_node_or_null(absolute), nullptr);
+		CHECK_EQ(parent->get_node_or_null(child->get_path()), child);
+
+		parent->reparent(SceneTree::get_singleton()->get_root());
+		CHECK_EQ(parent->get_node_or_null(absolute), child);
+		memdelete(grandparent);
+	}
+
+	SUBCASE("Changes elsewhere in the tree") {
+		Node *other = memnew(Node);
+		SceneTree::get_singleton()->get_root()->add_child(other);
+		Node *grandchild = memnew(Node);
+		child->add_child(grandchild);
+		CHECK_EQ(parent->get_node_or_null(path), child);
+		memdelete(other);
+		memdelete(grandchild);
+		CHECK_EQ(parent->get_node_or_null(path), child);
+	}
+
+	SUBCASE("Nodes outside the tree") {
+		SceneTree::get_singleton()->get_root()->remove_child(parent);
+		CHECK_EQ(parent->get_node_or_null(path), child);
+		child->set_name("Renamed");
+		CHECK_EQ(parent->get_node_or_null(path), nullptr);
+		CHECK_EQ(parent->get_node_or_null(NodePath("Renamed")), child);
+		SceneTree::get_singleton()->get_root()->add_child(parent);
+	}
+
+	SUBCASE("More paths than cache entries") {
+		for (int i = 0; i < 8; i++) {
+			Node *extra = memnew(Node);
+			extra->set_name(vformat("Extra%d", i));
+			parent->add_child(extra);
+		}
+		for (int pass = 0; pass < 2; pass++) {
+			for (int i = 0; i < 8; i++) {
+				Node *extra = parent->get_node_or_null(NodePath(vformat("Extra%d", i)));
+				REQUIRE(extra);
+				CHECK_EQ(String(extra->get_name()), vformat("Extra%d", i));
+			}
+		}
+	}
+
+	memdelete(parent);
+}
+
 TEST_CASE("[SceneTree][Node] Test the process priority") {
 	List<Node *> process_order;
 
@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TransformNotifiedNode3D : public Node3D {
+	GDCLASS(TransformNotifiedNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			notification_count++;
+		}
+	}
+
+public:
+	int notification_count = 0;
+
+	void set_ignoring_transform_notification(bool p_ignore) {
+		set_ignore_transform_notification(p_ignore);
+	}
+
+	TransformNotifiedNode3D() {
+		set_notify_transform(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node3D] Transform propagation") {
+	Node3D *root = memnew(Node3D);
+	Node3D *parent = memnew(Node3D);
+	TransformNotifiedNode3D *child = memnew(TransformNotifiedNode3D);
+	root->add_child(parent);
+	parent->add_child(child);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	child->notification_count = 0;
+
+	SUBCASE("Repeated changes in the same flush notify once") {
+		parent->set_position(Vector3(1, 0, 0));
+		root->set_position(Vector3(0, 2, 0));
+		parent->set_position(Vector3(3, 0, 0));
+		root->set_position(Vector3(0, 4, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		CHECK(child->notification_count == 1);
+		CHECK(child->get_global_position().is_equal_approx(Vector3(3, 4, 0)));
+	}
+
+	SUBCASE("Changes after a flush are propagated again") {
+		root->set_position(Vector3(0, 2, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(child->notification_count == 1);
+
+		// The child's global transform is still dirty, but it was notified and must be queued again.
+		root->set_position(Vector3(0, 5, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(child->notification_count == 2);
+		CHECK(child->get_global_position().is_equal_approx(Vector3(0, 5, 0)));
+	}
+
+	SUBCASE("Reading a global transform does not stop propagation") {
+		root->set_position(Vector3(0, 2, 0));
+		CHECK(child->get_global_position().is_equal_approx(Vector3(0, 2, 0)));
+		root->set_position(Vector3(0, 3, 0));
+		CHECK(child->get_global_position().is_equal_approx(Vector3(0, 3, 0)));
+	}
+
+	SUBCASE("Nodes that start listening are notified") {
+		Node3D *sibling = memnew(Node3D);
+		TransformNotifiedNode3D *listener = memnew(TransformNotifiedNode3D);
+		listener->set_notify_transform(false);
+		parent->add_child(sibling);
+		sibling->add_child(listener);
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		root->set_position(Vector3(0, 2, 0));
+		listener->set_notify_transform(true);
+		root->set_position(Vector3(0, 3, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(listener->notification_count == 1);
+	}
+
+	SUBCASE("Nodes that ignored a propagation are visited again through their ancestors") {
+		TransformNotifiedNode3D *grandchild = memnew(TransformNotifiedNode3D);
+		child->add_child(grandchild);
+		SceneTree::get_singleton()->flush_transform_notifications();
+		grandchild->notification_count = 0;
+
+		grandchild->set_ignoring_transform_notification(true);
+		root->set_position(Vector3(0, 2, 0));
+		grandchild->set_ignoring_transform_notification(false);
+		// Parent and child are still dirty from this epoch, but they must not hide the grandchild.
+		root->set_position(Vector3(0, 3, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(grandchild->notification_count == 1);
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(0, 3, 0)));
+	}
+
+	memdelete(root);
+}
+
+} // namespace TestNode3D
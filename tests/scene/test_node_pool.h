@@ -0,0 +1,130 @@
+/**************************************************************************/
+/*  test_node_pool.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/main/node_pool.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNodePool {
+
+TEST_CASE("[SceneTree][NodePool] Acquire and release") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(5);
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	Ref<NodePool> pool;
+	pool.instantiate();
+	pool->set_scene(packed_scene);
+
+	SUBCASE("Prewarmed instances are reused") {
+		pool->prewarm(2);
+		CHECK(pool->get_available_count() == 2);
+
+		Node *a = pool->acquire();
+		Node *b = pool->acquire();
+		Node *c = pool->acquire();
+		CHECK(a != nullptr);
+		CHECK(b != nullptr);
+		CHECK(c != nullptr);
+		CHECK(pool->get_available_count() == 0);
+		CHECK(pool->get_hit_count() == 2);
+		CHECK(pool->get_miss_count() == 1);
+
+		pool->release(a);
+		pool->release(b);
+		pool->release(c);
+		CHECK(pool->get_available_count() == 3);
+	}
+
+	SUBCASE("Released instances are detached and reset") {
+		Node *instance = pool->acquire();
+		SceneTree::get_singleton()->get_root()->add_child(instance);
+		instance->set_process_priority(10);
+		instance->get_node(NodePath("Child"))->set_physics_process_priority(3);
+
+		pool->release(instance);
+		CHECK(instance->get_parent() == nullptr);
+		CHECK(instance->get_process_priority() == 5);
+		CHECK(instance->get_node(NodePath("Child"))->get_physics_process_priority() == 0);
+
+		CHECK(pool->acquire() == instance);
+		pool->release(instance);
+	}
+
+	SUBCASE("Instances over capacity are freed") {
+		pool->set_capacity(1);
+		pool->prewarm(4);
+		CHECK(pool->get_available_count() == 1);
+
+		Node *a = pool->acquire();
+		Node *b = pool->acquire();
+		ObjectID b_id = b->get_instance_id();
+		pool->release(a);
+		pool->release(b);
+		CHECK(pool->get_available_count() == 1);
+
+		SceneTree::get_singleton()->process(0);
+		CHECK(ObjectDB::get_instance(b_id) == nullptr);
+	}
+
+	SUBCASE("Foreign nodes can't be released") {
+		Node *node = memnew(Node);
+		ERR_PRINT_OFF;
+		pool->release(node);
+		ERR_PRINT_ON;
+		CHECK(pool->get_available_count() == 0);
+		memdelete(node);
+
+		Node *instance = pool->acquire();
+		pool->release(instance);
+		ERR_PRINT_OFF;
+		pool->release(instance);
+		ERR_PRINT_ON;
+		CHECK(pool->get_available_count() == 1);
+	}
+
+	pool->clear();
+	SceneTree::get_singleton()->process(0);
+}
+
+} // namespace TestNodePool
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "scene/2d/node_2d.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -215,6 +216,63 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene In Batch") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(5);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	child->set_physics_process_priority(-3);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Instantiate the packed scene several times.
+	TypedArray<Node> instances = packed_scene.instantiate_batch(3);
+	CHECK(instances.size() == 3);
+
+	for (int i = 0; i < instances.size(); i++) {
+		Node *instance = Object::cast_to<Node>(instances[i]);
+		CHECK(instance != nullptr);
+		CHECK(instance->get_name() == "TestScene");
+		CHECK(instance->get_process_priority() == 5);
+		CHECK(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_physics_process_priority() == -3);
+		CHECK(instance->get_child(0)->get_owner() == instance);
+		memdelete(instance);
+	}
+
+	// Repacking with another root class and other stored properties must not reuse the previous setters.
+	Node2D *new_scene = memnew(Node2D);
+	new_scene->set_name("TestScene");
+	new_scene->set_position(Vector2(4, 2));
+	new_scene->set_process_priority(7);
+	scene->remove_child(child);
+	new_scene->add_child(child);
+	child->set_owner(new_scene);
+	child->set_physics_process_priority(0); // Default value, no longer stored.
+	child->set_process_priority(9);
+	packed_scene.pack(new_scene);
+
+	Node *instance = packed_scene.instantiate();
+	Node2D *instance_2d = Object::cast_to<Node2D>(instance);
+	REQUIRE(instance_2d != nullptr);
+	CHECK(instance_2d->get_position() == Vector2(4, 2));
+	CHECK(instance_2d->get_process_priority() == 7);
+	CHECK(instance_2d->get_child_count() == 1);
+	CHECK(instance_2d->get_child(0)->get_process_priority() == 9);
+	CHECK(instance_2d->get_child(0)->get_physics_process_priority() == 0);
+
+	memdelete(instance);
+	memdelete(new_scene);
+	memdelete(scene);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
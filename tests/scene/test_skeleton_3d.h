@@ -72,4 +72,33 @@ TEST_CASE("[Skeleton3D] Test per-bone meta") {
 	skeleton->set_bone_meta(0, "non-existing-key", Variant());
 	memdelete(skeleton);
 }
+
+TEST_CASE("[Skeleton3D] Global poses of several bone trees") {
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->add_bone("root_a");
+	skeleton->add_bone("child_a");
+	skeleton->set_bone_parent(1, 0);
+	skeleton->add_bone("root_b");
+	skeleton->add_bone("child_b");
+	skeleton->set_bone_parent(3, 2);
+
+	skeleton->set_bone_rest(0, Transform3D(Basis(), Vector3(1, 0, 0)));
+	skeleton->set_bone_rest(1, Transform3D(Basis(), Vector3(0, 1, 0)));
+	skeleton->set_bone_rest(2, Transform3D(Basis(), Vector3(0, 0, 1)));
+	skeleton->set_bone_rest(3, Transform3D(Basis(), Vector3(0, 2, 0)));
+	skeleton->reset_bone_poses();
+
+	skeleton->force_update_all_bone_transforms();
+	CHECK(skeleton->get_bone_global_pose(1).origin.is_equal_approx(Vector3(1, 1, 0)));
+	CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 2, 1)));
+	CHECK(skeleton->get_bone_global_rest(3).origin.is_equal_approx(Vector3(0, 2, 1)));
+
+	// Moving the second root updates its child without touching the first tree.
+	skeleton->set_bone_pose_position(2, Vector3(0, 0, 5));
+	skeleton->force_update_all_bone_transforms();
+	CHECK(skeleton->get_bone_global_pose(1).origin.is_equal_approx(Vector3(1, 1, 0)));
+	CHECK(skeleton->get_bone_global_pose(3).origin.is_equal_approx(Vector3(0, 2, 5)));
+
+	memdelete(skeleton);
+}
 } // namespace TestSkeleton3D
@@ -1097,6 +1097,41 @@ TEST_CASE("[SceneTree][TextEdit] text entry") {
 			SIGNAL_CHECK_FALSE("text_set");
 		}
 
+		SUBCASE("[TextEdit] line data follows inserted and removed lines") {
+			SIGNAL_DISCARD("text_set");
+			SIGNAL_DISCARD("text_changed");
+			SIGNAL_DISCARD("lines_edited_from");
+			SIGNAL_DISCARD("caret_changed");
+
+			text_edit->set_text("a\nb\nc");
+			text_edit->set_line_background_color(0, Color(1, 0, 0));
+			text_edit->set_line_background_color(2, Color(0, 0, 1));
+
+			text_edit->insert_text("x\ny\nz", 0, 1);
+			MessageQueue::get_singleton()->flush();
+			CHECK(text_edit->get_text() == "ax\ny\nz\nb\nc");
+			CHECK(text_edit->get_line_background_color(0) == Color(1, 0, 0));
+			CHECK(text_edit->get_line_background_color(1) == Color(0, 0, 0, 0));
+			CHECK(text_edit->get_line_background_color(4) == Color(0, 0, 1));
+
+			text_edit->remove_text(0, 2, 3, 1);
+			MessageQueue::get_singleton()->flush();
+			CHECK(text_edit->get_text() == "ax\nc");
+			CHECK(text_edit->get_line_background_color(0) == Color(1, 0, 0));
+			CHECK(text_edit->get_line_background_color(1) == Color(0, 0, 1));
+
+			text_edit->undo();
+			text_edit->undo();
+			MessageQueue::get_singleton()->flush();
+			CHECK(text_edit->get_text() == "a\nb\nc");
+			CHECK(text_edit->get_line_background_color(2) == Color(0, 0, 1));
+
+			SIGNAL_DISCARD("text_set");
+			SIGNAL_DISCARD("text_changed");
+			SIGNAL_DISCARD("lines_edited_from");
+			SIGNAL_DISCARD("caret_changed");
+		}
+
 		SUBCASE("[TextEdit] insert text at caret") {
 			lines_edited_args = { { 0, 1 } };
 
@@ -203,4 +203,83 @@ TEST_CASE("[SceneTree][Timer] Check Timer timeout signal") {
 	memdelete(test_timer);
 }
 
+TEST_CASE("[SceneTree][SceneTreeTimer] Check SceneTreeTimer timeout") {
+	SceneTree *tree = SceneTree::get_singleton();
+
+	SUBCASE("[SceneTreeTimer] Only expired timers emit timeout") {
+		Ref<SceneTreeTimer> short_timer = tree->create_timer(0.1);
+		Ref<SceneTreeTimer> long_timer = tree->create_timer(1.0);
+		SIGNAL_WATCH(short_timer.ptr(), SNAME("timeout"));
+		SIGNAL_WATCH(long_timer.ptr(), SNAME("timeout"));
+
+		tree->process(0.05);
+		CHECK(Math::is_equal_approx(short_timer->get_time_left(), 0.05));
+		SIGNAL_CHECK_FALSE(SNAME("timeout"));
+
+		tree->process(0.05);
+		Array signal_args = { {} };
+		SIGNAL_CHECK(SNAME("timeout"), signal_args);
+		CHECK(short_timer->get_time_left() == 0.0);
+		CHECK(Math::is_equal_approx(long_timer->get_time_left(), 0.9));
+
+		SIGNAL_UNWATCH(short_timer.ptr(), SNAME("timeout"));
+		SIGNAL_UNWATCH(long_timer.ptr(), SNAME("timeout"));
+	}
+
+	SUBCASE("[SceneTreeTimer] Changing time left reschedules the timer") {
+		Ref<SceneTreeTimer> timer = tree->create_timer(0.1);
+		SIGNAL_WATCH(timer.ptr(), SNAME("timeout"));
+
+		timer->set_time_left(0.5);
+		tree->process(0.2);
+		SIGNAL_CHECK_FALSE(SNAME("timeout"));
+		CHECK(Math::is_equal_approx(timer->get_time_left(), 0.3));
+
+		timer->set_time_left(0.01);
+		tree->process(0.02);
+		Array signal_args = { {} };
+		SIGNAL_CHECK(SNAME("timeout"), signal_args);
+
+		// A timer that already fired does not fire again.
+		timer->set_time_left(0.01);
+		tree->process(0.02);
+		SIGNAL_CHECK_FALSE(SNAME("timeout"));
+
+		SIGNAL_UNWATCH(timer.ptr(), SNAME("timeout"));
+	}
+
+	SUBCASE("[SceneTreeTimer] Pausable timers wait while the tree is paused") {
+		Ref<SceneTreeTimer> pausable_timer = tree->create_timer(0.1, false);
+		Ref<SceneTreeTimer> always_timer = tree->create_timer(0.1, true);
+		SIGNAL_WATCH(pausable_timer.ptr(), SNAME("timeout"));
+
+		tree->set_pause(true);
+		tree->process(0.2);
+		SIGNAL_CHECK_FALSE(SNAME("timeout"));
+		CHECK(Math::is_equal_approx(pausable_timer->get_time_left(), 0.1));
+		CHECK(always_timer->get_time_left() == 0.0);
+
+		tree->set_pause(false);
+		tree->process(0.2);
+		Array signal_args = { {} };
+		SIGNAL_CHECK(SNAME("timeout"), signal_args);
+
+		SIGNAL_UNWATCH(pausable_timer.ptr(), SNAME("timeout"));
+	}
+
+	SUBCASE("[SceneTreeTimer] Physics timers only advance on physics frames") {
+		Ref<SceneTreeTimer> timer = tree->create_timer(0.1, true, true);
+		SIGNAL_WATCH(timer.ptr(), SNAME("timeout"));
+
+		tree->process(0.2);
+		SIGNAL_CHECK_FALSE(SNAME("timeout"));
+
+		tree->physics_process(0.2);
+		Array signal_args = { {} };
+		SIGNAL_CHECK(SNAME("timeout"), signal_args);
+
+		SIGNAL_UNWATCH(timer.ptr(), SNAME("timeout"));
+	}
+}
+
 } // namespace TestTimer
@@ -1697,6 +1697,28 @@ TEST_CASE("[SceneTree][Viewport] Physics Picking 2D") {
 		}
 	}
 
+	SUBCASE("[Viewport][Picking2D] Mouse Motion events are merged until the next physics frame") {
+		SEND_GUI_MOUSE_MOTION_EVENT(on_01, MouseButtonMask::NONE, Key::NONE);
+		SEND_GUI_MOUSE_MOTION_EVENT(on_02, MouseButtonMask::NONE, Key::NONE);
+		tree->physics_process(1);
+		// Only the final position is picked, so the area below the intermediate position is never entered.
+		SIGNAL_CHECK(SceneStringName(mouse_entered), empty_signal_args_2);
+		CHECK(v[0].a->enter_id);
+		CHECK_FALSE(v[1].a->enter_id);
+		CHECK(v[2].a->enter_id);
+		CHECK_FALSE(v[3].a->enter_id);
+		for (PickingCollider E : v) {
+			E.a->test_reset();
+		}
+
+		SEND_GUI_MOUSE_MOTION_EVENT(on_outside, MouseButtonMask::NONE, Key::NONE);
+		tree->physics_process(1);
+		SIGNAL_CHECK(SceneStringName(mouse_exited), empty_signal_args_2);
+		for (PickingCollider E : v) {
+			E.a->test_reset();
+		}
+	}
+
 	SUBCASE("[Viewport][Picking2D] Object moved / passive hovering") {
 		SEND_GUI_MOUSE_MOTION_EVENT(on_all, MouseButtonMask::NONE, Key::NONE);
 		tree->physics_process(1);
@@ -136,6 +136,7 @@
 #include "tests/scene/test_instance_placeholder.h"
 #include "tests/scene/test_node.h"
 #include "tests/scene/test_node_2d.h"
+#include "tests/scene/test_node_pool.h"
 #include "tests/scene/test_packed_scene.h"
 #include "tests/scene/test_parallax_2d.h"
 #include "tests/scene/test_path_2d.h"
@@ -173,6 +174,7 @@
 #include "tests/scene/test_convert_transform_modifier_3d.h"
 #include "tests/scene/test_copy_transform_modifier_3d.h"
 #include "tests/scene/test_gltf_document.h"
+#include "tests/scene/test_node_3d.h"
 #include "tests/scene/test_path_3d.h"
 #include "tests/scene/test_path_follow_3d.h"
 #include "tests/scene/test_primitives.h"